@@ -0,0 +1,317 @@
+
+#include <string.h>
+
+#include "neslib.h"
+#include "platforms.h"
+#include "sprites.h"
+#include "anim.h"
+#include "actors.h"
+#include "physics.h"
+#include "rng.h"
+
+// actor state as parallel arrays, one byte per slot
+byte actor_x[MAX_ACTORS+1];
+byte actor_y[MAX_ACTORS+1];
+sbyte actor_vx[MAX_ACTORS+1];
+sbyte actor_vy[MAX_ACTORS+1];
+byte actor_type[MAX_ACTORS+1];
+byte actor_state[MAX_ACTORS+1];
+byte actor_row[MAX_ACTORS+1];
+byte actor_anim[MAX_ACTORS+1];
+
+// free list, linked through actor_next
+static byte actor_next[MAX_ACTORS];
+static byte actor_free;
+
+// broadphase rows, one bit per slot
+byte row_actors[ROWS];
+// first of the three rows each slot is in
+static byte actor_bucket[MAX_ACTORS];
+// row of screen row 0, moves back one row every scroll step
+static byte bucket_base;
+
+static const byte slot_bit[MAX_ACTORS] = {
+  0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+};
+
+// row holding screen y, with 240..255 above the top
+static byte bucket_of(byte y) {
+  byte r = (y >> 3) + bucket_base;
+  if (y >= 240) r += ROWS - 32;
+  if (r >= ROWS) r -= ROWS;
+  return r;
+}
+
+static byte next_row(byte r) {
+  return r == ROWS-1 ? 0 : r+1;
+}
+
+// a 16-pixel box spans at most three rows, starting at r
+static void bucket_set(byte i, byte r) {
+  byte b = slot_bit[i];
+  actor_bucket[i] = r;
+  row_actors[r] |= b;
+  r = next_row(r);
+  row_actors[r] |= b;
+  r = next_row(r);
+  row_actors[r] |= b;
+}
+
+static void bucket_clear(byte i) {
+  byte b = ~slot_bit[i];
+  byte r = actor_bucket[i];
+  row_actors[r] &= b;
+  r = next_row(r);
+  row_actors[r] &= b;
+  r = next_row(r);
+  row_actors[r] &= b;
+}
+
+// move slot i to the rows of its current y, if it changed
+static void bucket_move(byte i) {
+  byte r = bucket_of(actor_y[i]);
+  if (r != actor_bucket[i]) {
+    bucket_clear(i);
+    bucket_set(i, r);
+  }
+}
+
+// first slot drawn this frame
+static byte actor_first;
+
+// drift sideways, turning around at the screen edges
+static void update_ufo(byte i) {
+  actor_x[i] += actor_vx[i];
+  if (actor_x[i] < 8 || actor_x[i] > 232) {
+    actor_vx[i] = -actor_vx[i];
+  }
+}
+
+// slide sideways, turning around so the 32-pixel strip stays on screen
+static void update_mover(byte i) {
+  actor_x[i] += actor_vx[i];
+  if (actor_x[i] < 8 || actor_x[i] > 256-8-MOVER_W) {
+    actor_vx[i] = -actor_vx[i];
+  }
+}
+
+// the player's movement with random input: mostly keep going,
+// sometimes turn around or stop pressing
+static void update_jumper(byte i) {
+  byte joy = 0;
+  byte r = rng_next(RNG_ENEMIES);
+  if (r < 8) {
+    actor_state[i] ^= AS_RIGHT;
+  }
+  if (r & 0x30) {
+    joy = (actor_state[i] & AS_RIGHT) ? PAD_RIGHT : PAD_LEFT;
+  }
+  jumper_step(i, joy);
+  if (jumper_land(i) != NO_FLOOR) {
+    actor_anim[i] = ANIM_START(ANIM_JUMPER_LAND);
+  }
+  // fell off the bottom (248..255 is above the top, not below)
+  if (actor_y[i] >= 212 && actor_y[i] < 240) {
+    actor_despawn(i);
+  }
+}
+
+// per-type update, indexed by actor_type
+typedef void (*actor_fn)(byte i);
+
+static const actor_fn actor_update_fn[NUM_ACTOR_TYPES] = {
+  NULL,
+  update_ufo,
+  update_jumper,
+  update_mover,
+};
+
+// per-type first animation, indexed by actor_type
+static const byte actor_anim0[NUM_ACTOR_TYPES] = {
+  0,
+  ANIM_UFO,
+  ANIM_JUMPER,
+  ANIM_MOVER,
+};
+
+// per-type AF_ flags, indexed by actor_type
+static const byte actor_flags[NUM_ACTOR_TYPES] = {
+  0,
+  AF_HAZARD,
+  AF_HAZARD,
+  AF_FLOOR,
+};
+
+// free every slot
+void actors_clear(void) {
+  byte i;
+  for (i=0; i<MAX_ACTORS; i++) {
+    actor_type[i] = AT_NONE;
+    actor_next[i] = i+1;
+  }
+  actor_next[MAX_ACTORS-1] = NO_ACTOR;
+  actor_free = 0;
+  memset(row_actors, 0, sizeof(row_actors));
+  bucket_base = 0;
+}
+
+// take a slot from the free list, NO_ACTOR if the pool is full
+byte actor_spawn(byte type, byte x, byte y, byte row) {
+  byte i = actor_free;
+  if (i == NO_ACTOR) return NO_ACTOR;
+  actor_free = actor_next[i];
+  actor_type[i] = type;
+  actor_x[i] = x;
+  actor_y[i] = y;
+  actor_vx[i] = 0;
+  actor_vy[i] = 0;
+  actor_state[i] = 0;
+  actor_row[i] = row;
+  actor_anim[i] = ANIM_START(actor_anim0[type]);
+  bucket_set(i, bucket_of(y));
+  return i;
+}
+
+// return slot i to the free list
+void actor_despawn(byte i) {
+  bucket_clear(i);
+  actor_type[i] = AT_NONE;
+  actor_next[i] = actor_free;
+  actor_free = i;
+}
+
+// run every slot's update through its type (fixed cost per slot)
+void actors_update(void) {
+  byte i;
+  for (i=0; i<MAX_ACTORS; i++) {
+    if (actor_type[i]) {
+      actor_update_fn[actor_type[i]](i);
+      // the update may have despawned it
+      if (actor_type[i]) {
+        bucket_move(i);
+      }
+    }
+  }
+}
+
+// draw every slot, starting from a different actor each frame
+void actors_draw(void) {
+  byte i;
+  // odd step, so every slot gets to go first within 8 frames
+  actor_first = (actor_first + 3) & (MAX_ACTORS-1);
+  i = actor_first;
+  do {
+    if (actor_type[i]) {
+      // not above the top (240..255): the lower row would wrap
+      // around to the top scanlines, over the HUD
+      if (actor_y[i] < 240) {
+        spr_meta4(actor_x[i], actor_y[i],
+                  anim_sprite(actor_anim[i], actor_state[i] & AS_RIGHT));
+      }
+      actor_anim[i] = anim_step(actor_anim[i]);
+    }
+    i = (i + 1) & (MAX_ACTORS-1);
+  } while (i != actor_first);
+}
+
+// move actors down one row after a scroll step
+void actors_scroll(byte row) {
+  byte i;
+  bucket_base = bucket_base ? bucket_base-1 : ROWS-1;
+  for (i=0; i<MAX_ACTORS; i++) {
+    if (actor_type[i]) {
+      if (actor_row[i] == row) {
+        actor_despawn(i);
+      } else {
+        // only changes rows when crossing y 240
+        actor_y[i] += 8;
+        bucket_move(i);
+      }
+    }
+  }
+}
+
+// return the slot overlapping a 16x16 box at (x,y), or NO_ACTOR
+byte actors_hit(byte x, byte y) {
+  byte i, m, r;
+  r = bucket_of(y);
+  m = row_actors[r];
+  r = next_row(r);
+  m |= row_actors[r];
+  if (y & 7) {
+    m |= row_actors[next_row(r)];
+  }
+  for (i=0; m; i++, m >>= 1) {
+    if ((m & 1) &&
+        (actor_flags[actor_type[i]] & AF_HAZARD) &&
+        (byte)(actor_x[i] - x + 12) < 24 &&
+        (byte)(actor_y[i] - y + 12) < 24) {
+      return i;
+    }
+  }
+  return NO_ACTOR;
+}
+
+// return the slot whose box holds the point (x,y), or NO_ACTOR
+byte actors_at(byte x, byte y) {
+  byte i, m;
+  m = row_actors[bucket_of(y)];
+  for (i=0; m; i++, m >>= 1) {
+    if ((m & 1) &&
+        (actor_flags[actor_type[i]] & AF_HAZARD) &&
+        (byte)(x - actor_x[i]) < 16 &&
+        (byte)(y - actor_y[i]) < 16) {
+      return i;
+    }
+  }
+  return NO_ACTOR;
+}
+
+// return the AF_FLOOR slot a box at (x,y) lands on, or NO_ACTOR
+byte actors_floor(byte x, byte y) {
+  byte i, m, r;
+  // tops 8..24 pixels below y are in these three rows
+  r = bucket_of(y + 8);
+  m = row_actors[r];
+  r = next_row(r);
+  m |= row_actors[r];
+  m |= row_actors[next_row(r)];
+  for (i=0; m; i++, m >>= 1) {
+    if ((m & 1) &&
+        (actor_flags[actor_type[i]] & AF_FLOOR) &&
+        (byte)(actor_y[i] - 8 - y) <= 16 &&
+        (byte)(x - actor_x[i] + 8) < MOVER_W) {
+      return i;
+    }
+  }
+  return NO_ACTOR;
+}
+
+#ifdef ACTOR_BENCH
+// actor updates of n jumpers per frame, over 60 frames
+word actors_bench(byte n) {
+  word passes = 0;
+  byte i, clock;
+  actors_clear();
+  for (i=0; i<n; i++) {
+    actor_spawn(AT_JUMPER, 16 + i*24, 120, NO_ACTOR);
+  }
+  ppu_wait_nmi();
+  clock = nesclock() + 60;
+  while (nesclock() != clock) {
+    // keep them falling through the middle of the screen,
+    // where jumper_land() tests the most rows
+    for (i=0; i<n; i++) {
+      actor_y[i] = 120;
+      actor_vy[i] = 1;
+    }
+    spr_begin();
+    actors_update();
+    actors_draw();
+    spr_end();
+    ++passes;
+  }
+  actors_clear();
+  return passes * n / 60;
+}
+#endif
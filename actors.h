@@ -0,0 +1,101 @@
+
+#ifndef _ACTORS_H
+#define _ACTORS_H
+
+#include "neslib.h"
+#include "platforms.h"
+
+#define MAX_ACTORS 8		// max # of moving actors (8 bits in row_actors)
+#define NO_ACTOR 0xff		// end of the free list / no hit
+#define PLAYER MAX_ACTORS	// the player's slot, after the pool
+
+// actor types, index into the dispatch tables in actors.c
+#define AT_NONE		0	// free slot
+#define AT_UFO		1	// drifts sideways, ends the game on touch
+#define AT_JUMPER	2	// player physics with random input
+#define AT_MOVER	3	// moving platform, a 4-tile sprite strip
+#define NUM_ACTOR_TYPES	4
+
+// actor type flags
+#define AF_HAZARD	0x01	// ends the game on touch, can be shot
+#define AF_FLOOR	0x02	// can be landed on like a platform
+
+// moving platform box: 32 pixels wide, landed on like a static
+// platform whose tiles start at its y
+#define MOVER_W		32
+
+// actor_state bits
+#define AS_RIGHT	0x01	// facing right
+
+// actor state as parallel arrays, one byte per slot
+// y is in screen pixels, 248..255 is just above the top
+// the extra slot PLAYER is never spawned, updated or drawn here
+extern byte actor_x[MAX_ACTORS+1];
+extern byte actor_y[MAX_ACTORS+1];
+extern sbyte actor_vx[MAX_ACTORS+1];
+extern sbyte actor_vy[MAX_ACTORS+1];
+extern byte actor_type[MAX_ACTORS+1];
+extern byte actor_state[MAX_ACTORS+1];
+extern byte actor_row[MAX_ACTORS+1];	// ring row it belongs to
+extern byte actor_anim[MAX_ACTORS+1];	// animation state, see anim.h
+
+// broadphase: one bit per slot for the actors whose 16x16 box may
+// overlap each 8-pixel row, kept up to date as actors move
+// rows are indexed like ring rows, so they move with the playfield
+// and a scroll step doesn't move actors between rows
+// (y 240..255 counts as the two rows above the top)
+extern byte row_actors[ROWS];
+
+// free every slot
+void actors_clear(void);
+
+// take a slot from the free list, NO_ACTOR if the pool is full
+byte actor_spawn(byte type, byte x, byte y, byte row);
+
+// return slot i to the free list
+void actor_despawn(byte i);
+
+// run every slot's update through its type (fixed cost per slot)
+void actors_update(void);
+
+// draw every slot, starting from a different actor each frame
+// so sprites past the 8-per-scanline limit flicker instead of vanish
+void actors_draw(void);
+
+// move actors down one row after a scroll step,
+// despawning those on the ring row that just left the playfield
+void actors_scroll(byte row);
+
+// return the slot overlapping a 16x16 box at (x,y), or NO_ACTOR
+// only tests the actors in the 2 or 3 rows the box spans
+byte actors_hit(byte x, byte y);
+
+// return the slot whose box holds the point (x,y), or NO_ACTOR
+// only tests the actors in the row of the point
+byte actors_at(byte x, byte y);
+
+// return the AF_FLOOR slot a 16x16 box at (x,y) lands on, or NO_ACTOR
+// uses the same window as find_floor(): the top within 8..24
+// pixels below y, x within 8 pixels left or 24 right of the box
+byte actors_floor(byte x, byte y);
+
+// approximate cycles per frame (cc65, update + draw):
+//   free slot    ~25
+//   active UFO   ~480 (dispatch ~60, update ~90, anim ~30, spr_meta4 ~300)
+//   jumper       ~900 worst case (update ~570, see physics.h)
+//   mover        ~440 (update ~80, spr_meta4 ~300), 4 OAM slots
+//   row change   ~250 (when an actor crosses an 8-pixel row)
+// so a full pool of UFOs costs about 3800 cycles, 13% of a frame;
+// 4 jumpers ~3800 (13%), 8 jumpers ~7200 (24%)
+// a query costs ~120 plus ~25 per slot up to the highest candidate
+// and ~60 per candidate, instead of ~80 for every slot
+// at the most movers (the full pool) that is 32 of the 63 rotating
+// OAM slots and ~3500 cycles, 12% of a frame, plus ~250 per
+// find_floor() call with two movers in its rows
+
+#ifdef ACTOR_BENCH
+// actor updates of n jumpers per frame (halts the game)
+word actors_bench(byte n);
+#endif
+
+#endif // actors.h
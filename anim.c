@@ -0,0 +1,57 @@
+
+#include "neslib.h"
+#include "sprites.h"
+#include "anim.h"
+
+// player, tiles 0xe8..0xeb
+DEF_METASPRITE_2x2(playerR, 0xe8, 0);
+DEF_METASPRITE_2x2_FLIP(playerL, 0xe8, 0);
+DEF_METASPRITE_2x2_TOP(crouchR, 0xe8, 0, 3);
+DEF_METASPRITE_2x2_TOP_FLIP(crouchL, 0xe8, 0, 3);
+DEF_METASPRITE_2x2_TOP(stretchR, 0xe8, 0, -2);
+DEF_METASPRITE_2x2_TOP_FLIP(stretchL, 0xe8, 0, -2);
+DEF_METASPRITE_2x2_TOP(fallR, 0xe8, 0, 1);
+DEF_METASPRITE_2x2_TOP_FLIP(fallL, 0xe8, 0, 1);
+DEF_METASPRITE_2x2_VFLIP(deadR, 0xe8, 0);
+
+// UFO, tiles 0xd8..0xdb
+DEF_METASPRITE_2x2(ufoA, 0xd8, 1);
+DEF_METASPRITE_2x2_TOP(ufoB, 0xd8, 1, 1);
+
+// jumper, the player's tiles in sprite palette 2
+DEF_METASPRITE_2x2(jumperR, 0xe8, 2);
+DEF_METASPRITE_2x2_FLIP(jumperL, 0xe8, 2);
+DEF_METASPRITE_2x2_TOP(jcrouchR, 0xe8, 2, 3);
+DEF_METASPRITE_2x2_TOP_FLIP(jcrouchL, 0xe8, 2, 3);
+
+// moving platform, the background platform tiles 0x83..0x85
+DEF_METASPRITE_4x1(mover, 0x83, 0x84, 0x85, 3);
+
+const AnimFrame anim_frames[] = {
+  { 8, 0, playerL,  playerR },	// 0 ANIM_IDLE
+  { 4, 2, crouchL,  crouchR },	// 1 ANIM_CROUCH
+  { 8, 2, stretchL, stretchR },	// 2 ANIM_RISE
+  { 8, 3, fallL,    fallR },	// 3 ANIM_FALL
+  { 6, 5, deadR,    deadR },	// 4 ANIM_DEATH
+  { 6, 4, playerL,  playerR },	// 5
+  { 8, 7, ufoA,     ufoA },	// 6 ANIM_UFO
+  { 8, 6, ufoB,     ufoB },	// 7
+  { 8, 8, jumperL,  jumperR },	// 8 ANIM_JUMPER
+  { 4, 8, jcrouchL, jcrouchR },	// 9 ANIM_JUMPER_LAND
+  { 8, 10, mover,   mover },	// 10 ANIM_MOVER
+};
+
+// advance an animation state by one frame
+byte anim_step(byte st) {
+  const AnimFrame* f = &anim_frames[st >> 3];
+  if ((st & 7) + 1 < f->duration) {
+    return st + 1;
+  }
+  return f->next << 3;
+}
+
+// metasprite for an animation state (facing 0 = left, 1 = right)
+const unsigned char* anim_sprite(byte st, byte facing) {
+  const AnimFrame* f = &anim_frames[st >> 3];
+  return facing ? f->right : f->left;
+}
@@ -0,0 +1,38 @@
+
+#ifndef _ANIM_H
+#define _ANIM_H
+
+#include "neslib.h"
+
+// first entry of each animation in the frame table
+#define ANIM_IDLE	0
+#define ANIM_CROUCH	1	// on bounce, then continues to ANIM_RISE
+#define ANIM_RISE	2
+#define ANIM_FALL	3
+#define ANIM_DEATH	4
+#define ANIM_UFO	6
+#define ANIM_JUMPER	8
+#define ANIM_JUMPER_LAND 9	// on bounce, then back to ANIM_JUMPER
+#define ANIM_MOVER	10
+
+// an animation state is one byte: entry << 3 | frames shown
+// so an entry lasts at most 8 frames and the table 32 entries
+#define ANIM_START(a)	((a) << 3)
+#define ANIM_ENTRY(st)	((st) >> 3)
+
+typedef struct AnimFrame {
+  byte duration;		// frames to show, 1..8
+  byte next;			// entry to continue with
+  const unsigned char* left;	// metasprite facing left
+  const unsigned char* right;	// metasprite facing right
+} AnimFrame;
+
+extern const AnimFrame anim_frames[];
+
+// advance an animation state by one frame
+byte anim_step(byte st);
+
+// metasprite for an animation state (facing 0 = left, 1 = right)
+const unsigned char* anim_sprite(byte st, byte facing);
+
+#endif // anim.h
@@ -0,0 +1,78 @@
+
+#include "neslib.h"
+#include "vrambuf.h"
+#include "attrib.h"
+#include <string.h>
+
+// RAM copy of the attribute tables of nametables A and C
+byte attr_shadow[2][64];
+
+// attribute bytes of the row being built
+static byte attr_row[8];
+static byte attr_nt;	// 0 = nametable A, 1 = nametable C
+static byte attr_y;	// tile row within the nametable
+
+// return attribute table address for nametable address a
+word nt2attraddr(word a) {
+  return (a & 0x2c00) | 0x3c0 |
+    ((a >> 4) & 0x38) | ((a >> 2) & 0x07);
+}
+
+// clear attribute tables and shadow (rendering must be off)
+void attr_clear(void) {
+  memset(attr_shadow, 0, sizeof(attr_shadow));
+  vram_adr(nt2attraddr(NAMETABLE_A));
+  vram_fill(0, 64);
+  vram_adr(nt2attraddr(NAMETABLE_C));
+  vram_fill(0, 64);
+}
+
+// start a new attribute row for ring row r (0..59)
+void attr_begin_row(byte r) {
+  byte i;
+  byte keep;
+  byte* src;
+  if (r < 30) {
+    attr_nt = 0;
+    attr_y = r;
+  } else {
+    attr_nt = 1;
+    attr_y = r - 30;
+  }
+  // keep the half of each cell that belongs to other rows
+  keep = (attr_y & 2) ? 0x0f : 0xf0;
+  src = &attr_shadow[attr_nt][(attr_y >> 2) << 3];
+  for (i=0; i<8; i++) {
+    attr_row[i] = src[i] & keep;
+  }
+}
+
+// set palette pal for tiles x..x+len-1 of the current row
+void attr_paint(byte x, byte len, byte pal) {
+  byte end = x + len;
+  byte shift;
+  byte i;
+  for (x &= ~1; x < end; x += 2) {
+    shift = ((attr_y & 2) << 1) | (x & 2);
+    i = x >> 2;
+    attr_row[i] = (attr_row[i] & ~(3 << shift)) | (pal << shift);
+  }
+}
+
+// queue only the changed attribute bytes of the current row
+void attr_end_row(void) {
+  byte first, last;
+  word addr;
+  byte* dst = &attr_shadow[attr_nt][(attr_y >> 2) << 3];
+  // find the changed span
+  for (first=0; first<8; first++) {
+    if (attr_row[first] != dst[first]) break;
+  }
+  if (first == 8) return;
+  for (last=7; last>first; last--) {
+    if (attr_row[last] != dst[last]) break;
+  }
+  memcpy(dst+first, attr_row+first, last-first+1);
+  addr = attr_nt ? NTADR_C(0,attr_y) : NTADR_A(0,attr_y);
+  vrambuf_put(nt2attraddr(addr)+first, attr_row+first, last-first+1);
+}
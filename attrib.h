@@ -0,0 +1,34 @@
+
+#ifndef _ATTRIB_H
+#define _ATTRIB_H
+
+#include "neslib.h"
+
+// background palettes for each kind of platform
+#define PAL_NORMAL	0
+#define PAL_ITEM	1
+#define PAL_HAZARD	2
+#define PAL_BROKEN	3
+
+// RAM copy of the attribute tables of nametables A and C
+extern byte attr_shadow[2][64];
+
+// return attribute table address for nametable address a
+word nt2attraddr(word a);
+
+// clear attribute tables and shadow (rendering must be off)
+void attr_clear(void);
+
+// start a new attribute row for ring row r (0..59)
+// keeps the other half of each 32x32 attribute cell
+void attr_begin_row(byte r);
+
+// set palette pal for tiles x..x+len-1 of the current row
+// (16x16 pixel granularity, so this also colors the paired row)
+void attr_paint(byte x, byte len, byte pal);
+
+// queue only the changed attribute bytes of the current row
+// costs nothing if unchanged, at most 3+8 buffer bytes
+void attr_end_row(void);
+
+#endif // attrib.h
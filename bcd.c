@@ -11,3 +11,11 @@ word bcd_add(word a, word b) {
   return c - d;            // corrected BCD sum
 }
 
+
+// convert 0..255 to packed BCD
+word bcd_from_byte(byte n) {
+  register word r = 0;
+  while (n >= 100) { n -= 100; r += 0x100; }
+  while (n >= 10) { n -= 10; r += 0x10; }
+  return r + n;
+}
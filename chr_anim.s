@@ -0,0 +1,519 @@
+;;{w:8,h:8,bpp:1,count:256,brev:1,np:2,pofs:8,remap:[0,1,2,4,5,6,7,8,9,10,11,12]};;
+;background animation frames: tiles $80-$bf of chr_generic.s four times,
+;one 1 KB CHR bank each, switched in by chr_anim_tick() (mapper.s)
+;$86-$87 broken platform with a glint moving across, $a0 star twinkling
+;($91-$92 are the same cracked tiles without the glint, for crumbling)
+.segment "CHARS"
+.byte $00,$00,$00,$00,$00,$00,$00,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $F0,$F0,$F0,$F0,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$00,$00,$00,$00
+.byte $00,$00,$07,$08,$08,$08,$07,$00
+.byte $00,$00,$07,$0F,$0F,$0F,$07,$00
+.byte $00,$00,$FF,$00,$00,$00,$FF,$00
+.byte $00,$00,$FF,$FF,$FF,$FF,$FF,$00
+.byte $00,$00,$E0,$10,$10,$10,$E0,$00
+.byte $00,$00,$E0,$F0,$F0,$F0,$E0,$00
+.byte $00,$00,$55,$40,$A0,$C0,$B6,$00
+.byte $00,$00,$55,$5D,$AD,$DD,$B6,$00
+.byte $00,$00,$DD,$00,$00,$00,$DB,$00
+.byte $00,$00,$DD,$EB,$DF,$BD,$DB,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $F0,$F0,$F0,$F0,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $FF,$FF,$FF,$FF,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $F0,$F0,$F0,$F0,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$24,$00,$81,$10,$42
+.byte $00,$00,$00,$24,$00,$81,$10,$42
+.byte $00,$00,$55,$00,$00,$00,$B6,$00
+.byte $00,$00,$55,$5D,$AD,$DD,$B6,$00
+.byte $00,$00,$DD,$00,$00,$00,$DB,$00
+.byte $00,$00,$DD,$EB,$DF,$BD,$DB,$00
+.byte $1F,$1F,$1F,$E0,$E0,$E0,$E0,$E0
+.byte $FF,$FF,$FF,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$F0,$F0,$F0,$F0
+.byte $FF,$FF,$FF,$FF,$00,$00,$00,$00
+.byte $07,$07,$07,$07,$07,$F8,$F8,$F8
+.byte $FF,$FF,$FF,$FF,$FF,$00,$00,$00
+.byte $03,$03,$03,$03,$03,$03,$FC,$FC
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$00,$00
+.byte $01,$01,$01,$01,$01,$01,$01,$FE
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $7F,$80,$80,$80,$80,$80,$80,$80
+.byte $00,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $3F,$3F,$C0,$C0,$C0,$C0,$C0,$C0
+.byte $00,$00,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $1F,$1F,$1F,$E0,$E0,$E0,$E0,$E0
+.byte $00,$00,$00,$FF,$FF,$FF,$FF,$FF
+.byte $0F,$0F,$0F,$0F,$F0,$F0,$F0,$F0
+.byte $00,$00,$00,$00,$FF,$FF,$FF,$FF
+.byte $07,$07,$07,$07,$07,$F8,$F8,$F8
+.byte $00,$00,$00,$00,$00,$FF,$FF,$FF
+.byte $03,$03,$03,$03,$03,$03,$FC,$FC
+.byte $00,$00,$00,$00,$00,$00,$FF,$FF
+.byte $01,$01,$01,$01,$01,$01,$01,$FE
+.byte $00,$00,$00,$00,$00,$00,$00,$FF
+.byte $18,$3C,$FF,$FF,$7E,$7E,$7E,$7E
+.byte $10,$38,$FE,$7C,$38,$7C,$6C,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $80,$80,$80,$80,$80,$80,$80,$80
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $01,$01,$01,$01,$01,$01,$01,$01
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$03,$0C,$30,$C0
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $03,$0C,$30,$C0,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $C0,$30,$0C,$03,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$C0,$30,$0C,$03
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $10,$10,$20,$20,$40,$40,$80,$80
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $01,$01,$02,$02,$04,$04,$08,$08
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $80,$80,$40,$40,$20,$20,$10,$10
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $08,$08,$04,$04,$02,$02,$01,$01
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $01,$02,$04,$08,$10,$20,$40,$80
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $80,$40,$20,$10,$08,$04,$02,$01
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $81,$42,$24,$18,$18,$24,$42,$81
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $3C,$42,$81,$81,$81,$81,$42,$3C
+.byte $0C,$00,$10,$00,$00,$00,$04,$00
+.byte $0C,$00,$10,$3E,$2E,$2E,$2A,$2E
+.byte $00,$3C,$BC,$5A,$00,$20,$24,$7E
+.byte $18,$00,$80,$42,$18,$04,$00,$12
+.byte $00,$FF,$00,$FF,$00,$FF,$00,$FF
+.byte $55,$AA,$55,$AA,$55,$AA,$55,$AA
+.byte $24,$00,$5A,$00,$24,$00,$18,$00
+.byte $24,$00,$5A,$00,$24,$00,$18,$3C
+.byte $4D,$41,$00,$2E,$24,$24,$6A,$6E
+.byte $0C,$00,$10,$3E,$2E,$2E,$2A,$2E
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $E7,$C3,$C3,$E7,$E7,$DB,$DB,$93
+.byte $24,$24,$C3,$08,$18,$C3,$24,$24
+.byte $18,$66,$42,$91,$89,$42,$66,$18
+.byte $18,$24,$00,$24,$00,$18,$00,$00
+.byte $24,$00,$5A,$00,$24,$00,$18,$3C
+.byte $5A,$36,$00,$00,$6C,$3B,$76,$00
+.byte $24,$7E,$54,$45,$48,$7E,$3E,$00
+.byte $00,$08,$14,$2A,$55,$2A,$14,$08
+.byte $80,$49,$36,$3E,$5D,$3E,$36,$49
+.byte $0F,$1F,$3F,$3D,$38,$38,$3C,$16
+.byte $0F,$1F,$3F,$3F,$3F,$3F,$3F,$17
+.byte $F0,$F8,$BC,$14,$A0,$A0,$08,$1C
+.byte $F0,$F8,$FC,$FC,$58,$58,$F8,$FC
+.byte $F2,$F1,$E1,$0F,$1F,$3B,$11,$00
+.byte $0D,$0E,$0E,$00,$00,$04,$0E,$0F
+.byte $00,$E0,$F0,$F0,$F8,$DC,$88,$00
+.byte $C0,$00,$00,$00,$00,$20,$70,$78
+.byte $F2,$F1,$E1,$1F,$3F,$13,$03,$00
+.byte $0D,$0E,$0E,$00,$00,$2C,$3C,$20
+.byte $00,$E0,$F0,$F8,$E0,$C0,$00,$00
+.byte $C0,$00,$00,$04,$1C,$3C,$1C,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $F0,$F0,$F0,$F0,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$00,$00,$00,$00
+.byte $00,$00,$07,$08,$08,$08,$07,$00
+.byte $00,$00,$07,$0F,$0F,$0F,$07,$00
+.byte $00,$00,$FF,$00,$00,$00,$FF,$00
+.byte $00,$00,$FF,$FF,$FF,$FF,$FF,$00
+.byte $00,$00,$E0,$10,$10,$10,$E0,$00
+.byte $00,$00,$E0,$F0,$F0,$F0,$E0,$00
+.byte $00,$00,$55,$0C,$0C,$0C,$B6,$00
+.byte $00,$00,$55,$5D,$AD,$DD,$B6,$00
+.byte $00,$00,$DD,$00,$00,$00,$DB,$00
+.byte $00,$00,$DD,$EB,$DF,$BD,$DB,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $F0,$F0,$F0,$F0,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $FF,$FF,$FF,$FF,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $F0,$F0,$F0,$F0,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$24,$00,$81,$10,$42
+.byte $00,$00,$00,$24,$00,$81,$10,$42
+.byte $00,$00,$55,$00,$00,$00,$B6,$00
+.byte $00,$00,$55,$5D,$AD,$DD,$B6,$00
+.byte $00,$00,$DD,$00,$00,$00,$DB,$00
+.byte $00,$00,$DD,$EB,$DF,$BD,$DB,$00
+.byte $1F,$1F,$1F,$E0,$E0,$E0,$E0,$E0
+.byte $FF,$FF,$FF,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$F0,$F0,$F0,$F0
+.byte $FF,$FF,$FF,$FF,$00,$00,$00,$00
+.byte $07,$07,$07,$07,$07,$F8,$F8,$F8
+.byte $FF,$FF,$FF,$FF,$FF,$00,$00,$00
+.byte $03,$03,$03,$03,$03,$03,$FC,$FC
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$00,$00
+.byte $01,$01,$01,$01,$01,$01,$01,$FE
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $7F,$80,$80,$80,$80,$80,$80,$80
+.byte $00,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $3F,$3F,$C0,$C0,$C0,$C0,$C0,$C0
+.byte $00,$00,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $1F,$1F,$1F,$E0,$E0,$E0,$E0,$E0
+.byte $00,$00,$00,$FF,$FF,$FF,$FF,$FF
+.byte $0F,$0F,$0F,$0F,$F0,$F0,$F0,$F0
+.byte $00,$00,$00,$00,$FF,$FF,$FF,$FF
+.byte $07,$07,$07,$07,$07,$F8,$F8,$F8
+.byte $00,$00,$00,$00,$00,$FF,$FF,$FF
+.byte $03,$03,$03,$03,$03,$03,$FC,$FC
+.byte $00,$00,$00,$00,$00,$00,$FF,$FF
+.byte $01,$01,$01,$01,$01,$01,$01,$FE
+.byte $00,$00,$00,$00,$00,$00,$00,$FF
+.byte $18,$3C,$E7,$E7,$7E,$7E,$7E,$7E
+.byte $18,$3C,$FF,$FF,$7E,$7E,$7E,$7E
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $80,$80,$80,$80,$80,$80,$80,$80
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $01,$01,$01,$01,$01,$01,$01,$01
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$03,$0C,$30,$C0
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $03,$0C,$30,$C0,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $C0,$30,$0C,$03,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$C0,$30,$0C,$03
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $10,$10,$20,$20,$40,$40,$80,$80
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $01,$01,$02,$02,$04,$04,$08,$08
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $80,$80,$40,$40,$20,$20,$10,$10
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $08,$08,$04,$04,$02,$02,$01,$01
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $01,$02,$04,$08,$10,$20,$40,$80
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $80,$40,$20,$10,$08,$04,$02,$01
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $81,$42,$24,$18,$18,$24,$42,$81
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $3C,$42,$81,$81,$81,$81,$42,$3C
+.byte $0C,$00,$10,$00,$00,$00,$04,$00
+.byte $0C,$00,$10,$3E,$2E,$2E,$2A,$2E
+.byte $00,$3C,$BC,$5A,$00,$20,$24,$7E
+.byte $18,$00,$80,$42,$18,$04,$00,$12
+.byte $00,$FF,$00,$FF,$00,$FF,$00,$FF
+.byte $55,$AA,$55,$AA,$55,$AA,$55,$AA
+.byte $24,$00,$5A,$00,$24,$00,$18,$00
+.byte $24,$00,$5A,$00,$24,$00,$18,$3C
+.byte $4D,$41,$00,$2E,$24,$24,$6A,$6E
+.byte $0C,$00,$10,$3E,$2E,$2E,$2A,$2E
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $E7,$C3,$C3,$E7,$E7,$DB,$DB,$93
+.byte $24,$24,$C3,$08,$18,$C3,$24,$24
+.byte $18,$66,$42,$91,$89,$42,$66,$18
+.byte $18,$24,$00,$24,$00,$18,$00,$00
+.byte $24,$00,$5A,$00,$24,$00,$18,$3C
+.byte $5A,$36,$00,$00,$6C,$3B,$76,$00
+.byte $24,$7E,$54,$45,$48,$7E,$3E,$00
+.byte $00,$08,$14,$2A,$55,$2A,$14,$08
+.byte $80,$49,$36,$3E,$5D,$3E,$36,$49
+.byte $0F,$1F,$3F,$3D,$38,$38,$3C,$16
+.byte $0F,$1F,$3F,$3F,$3F,$3F,$3F,$17
+.byte $F0,$F8,$BC,$14,$A0,$A0,$08,$1C
+.byte $F0,$F8,$FC,$FC,$58,$58,$F8,$FC
+.byte $F2,$F1,$E1,$0F,$1F,$3B,$11,$00
+.byte $0D,$0E,$0E,$00,$00,$04,$0E,$0F
+.byte $00,$E0,$F0,$F0,$F8,$DC,$88,$00
+.byte $C0,$00,$00,$00,$00,$20,$70,$78
+.byte $F2,$F1,$E1,$1F,$3F,$13,$03,$00
+.byte $0D,$0E,$0E,$00,$00,$2C,$3C,$20
+.byte $00,$E0,$F0,$F8,$E0,$C0,$00,$00
+.byte $C0,$00,$00,$04,$1C,$3C,$1C,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $F0,$F0,$F0,$F0,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$00,$00,$00,$00
+.byte $00,$00,$07,$08,$08,$08,$07,$00
+.byte $00,$00,$07,$0F,$0F,$0F,$07,$00
+.byte $00,$00,$FF,$00,$00,$00,$FF,$00
+.byte $00,$00,$FF,$FF,$FF,$FF,$FF,$00
+.byte $00,$00,$E0,$10,$10,$10,$E0,$00
+.byte $00,$00,$E0,$F0,$F0,$F0,$E0,$00
+.byte $00,$00,$55,$00,$00,$00,$B6,$00
+.byte $00,$00,$55,$5D,$AD,$DD,$B6,$00
+.byte $00,$00,$DD,$E0,$C0,$A0,$DB,$00
+.byte $00,$00,$DD,$EB,$DF,$BD,$DB,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $F0,$F0,$F0,$F0,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $FF,$FF,$FF,$FF,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $F0,$F0,$F0,$F0,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$24,$00,$81,$10,$42
+.byte $00,$00,$00,$24,$00,$81,$10,$42
+.byte $00,$00,$55,$00,$00,$00,$B6,$00
+.byte $00,$00,$55,$5D,$AD,$DD,$B6,$00
+.byte $00,$00,$DD,$00,$00,$00,$DB,$00
+.byte $00,$00,$DD,$EB,$DF,$BD,$DB,$00
+.byte $1F,$1F,$1F,$E0,$E0,$E0,$E0,$E0
+.byte $FF,$FF,$FF,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$F0,$F0,$F0,$F0
+.byte $FF,$FF,$FF,$FF,$00,$00,$00,$00
+.byte $07,$07,$07,$07,$07,$F8,$F8,$F8
+.byte $FF,$FF,$FF,$FF,$FF,$00,$00,$00
+.byte $03,$03,$03,$03,$03,$03,$FC,$FC
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$00,$00
+.byte $01,$01,$01,$01,$01,$01,$01,$FE
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $7F,$80,$80,$80,$80,$80,$80,$80
+.byte $00,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $3F,$3F,$C0,$C0,$C0,$C0,$C0,$C0
+.byte $00,$00,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $1F,$1F,$1F,$E0,$E0,$E0,$E0,$E0
+.byte $00,$00,$00,$FF,$FF,$FF,$FF,$FF
+.byte $0F,$0F,$0F,$0F,$F0,$F0,$F0,$F0
+.byte $00,$00,$00,$00,$FF,$FF,$FF,$FF
+.byte $07,$07,$07,$07,$07,$F8,$F8,$F8
+.byte $00,$00,$00,$00,$00,$FF,$FF,$FF
+.byte $03,$03,$03,$03,$03,$03,$FC,$FC
+.byte $00,$00,$00,$00,$00,$00,$FF,$FF
+.byte $01,$01,$01,$01,$01,$01,$01,$FE
+.byte $00,$00,$00,$00,$00,$00,$00,$FF
+.byte $18,$3C,$FF,$FF,$7E,$7E,$7E,$7E
+.byte $10,$38,$FE,$7C,$38,$7C,$6C,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $80,$80,$80,$80,$80,$80,$80,$80
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $01,$01,$01,$01,$01,$01,$01,$01
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$03,$0C,$30,$C0
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $03,$0C,$30,$C0,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $C0,$30,$0C,$03,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$C0,$30,$0C,$03
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $10,$10,$20,$20,$40,$40,$80,$80
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $01,$01,$02,$02,$04,$04,$08,$08
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $80,$80,$40,$40,$20,$20,$10,$10
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $08,$08,$04,$04,$02,$02,$01,$01
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $01,$02,$04,$08,$10,$20,$40,$80
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $80,$40,$20,$10,$08,$04,$02,$01
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $81,$42,$24,$18,$18,$24,$42,$81
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $3C,$42,$81,$81,$81,$81,$42,$3C
+.byte $0C,$00,$10,$00,$00,$00,$04,$00
+.byte $0C,$00,$10,$3E,$2E,$2E,$2A,$2E
+.byte $00,$3C,$BC,$5A,$00,$20,$24,$7E
+.byte $18,$00,$80,$42,$18,$04,$00,$12
+.byte $00,$FF,$00,$FF,$00,$FF,$00,$FF
+.byte $55,$AA,$55,$AA,$55,$AA,$55,$AA
+.byte $24,$00,$5A,$00,$24,$00,$18,$00
+.byte $24,$00,$5A,$00,$24,$00,$18,$3C
+.byte $4D,$41,$00,$2E,$24,$24,$6A,$6E
+.byte $0C,$00,$10,$3E,$2E,$2E,$2A,$2E
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $E7,$C3,$C3,$E7,$E7,$DB,$DB,$93
+.byte $24,$24,$C3,$08,$18,$C3,$24,$24
+.byte $18,$66,$42,$91,$89,$42,$66,$18
+.byte $18,$24,$00,$24,$00,$18,$00,$00
+.byte $24,$00,$5A,$00,$24,$00,$18,$3C
+.byte $5A,$36,$00,$00,$6C,$3B,$76,$00
+.byte $24,$7E,$54,$45,$48,$7E,$3E,$00
+.byte $00,$08,$14,$2A,$55,$2A,$14,$08
+.byte $80,$49,$36,$3E,$5D,$3E,$36,$49
+.byte $0F,$1F,$3F,$3D,$38,$38,$3C,$16
+.byte $0F,$1F,$3F,$3F,$3F,$3F,$3F,$17
+.byte $F0,$F8,$BC,$14,$A0,$A0,$08,$1C
+.byte $F0,$F8,$FC,$FC,$58,$58,$F8,$FC
+.byte $F2,$F1,$E1,$0F,$1F,$3B,$11,$00
+.byte $0D,$0E,$0E,$00,$00,$04,$0E,$0F
+.byte $00,$E0,$F0,$F0,$F8,$DC,$88,$00
+.byte $C0,$00,$00,$00,$00,$20,$70,$78
+.byte $F2,$F1,$E1,$1F,$3F,$13,$03,$00
+.byte $0D,$0E,$0E,$00,$00,$2C,$3C,$20
+.byte $00,$E0,$F0,$F8,$E0,$C0,$00,$00
+.byte $C0,$00,$00,$04,$1C,$3C,$1C,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $F0,$F0,$F0,$F0,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$00,$00,$00,$00
+.byte $00,$00,$07,$08,$08,$08,$07,$00
+.byte $00,$00,$07,$0F,$0F,$0F,$07,$00
+.byte $00,$00,$FF,$00,$00,$00,$FF,$00
+.byte $00,$00,$FF,$FF,$FF,$FF,$FF,$00
+.byte $00,$00,$E0,$10,$10,$10,$E0,$00
+.byte $00,$00,$E0,$F0,$F0,$F0,$E0,$00
+.byte $00,$00,$55,$00,$00,$00,$B6,$00
+.byte $00,$00,$55,$5D,$AD,$DD,$B6,$00
+.byte $00,$00,$DD,$0A,$0E,$0C,$DB,$00
+.byte $00,$00,$DD,$EB,$DF,$BD,$DB,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $F0,$F0,$F0,$F0,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $FF,$FF,$FF,$FF,$0F,$0F,$0F,$0F
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $F0,$F0,$F0,$F0,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $00,$00,$00,$24,$00,$81,$10,$42
+.byte $00,$00,$00,$24,$00,$81,$10,$42
+.byte $00,$00,$55,$00,$00,$00,$B6,$00
+.byte $00,$00,$55,$5D,$AD,$DD,$B6,$00
+.byte $00,$00,$DD,$00,$00,$00,$DB,$00
+.byte $00,$00,$DD,$EB,$DF,$BD,$DB,$00
+.byte $1F,$1F,$1F,$E0,$E0,$E0,$E0,$E0
+.byte $FF,$FF,$FF,$00,$00,$00,$00,$00
+.byte $0F,$0F,$0F,$0F,$F0,$F0,$F0,$F0
+.byte $FF,$FF,$FF,$FF,$00,$00,$00,$00
+.byte $07,$07,$07,$07,$07,$F8,$F8,$F8
+.byte $FF,$FF,$FF,$FF,$FF,$00,$00,$00
+.byte $03,$03,$03,$03,$03,$03,$FC,$FC
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$00,$00
+.byte $01,$01,$01,$01,$01,$01,$01,$FE
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $7F,$80,$80,$80,$80,$80,$80,$80
+.byte $00,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $3F,$3F,$C0,$C0,$C0,$C0,$C0,$C0
+.byte $00,$00,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $1F,$1F,$1F,$E0,$E0,$E0,$E0,$E0
+.byte $00,$00,$00,$FF,$FF,$FF,$FF,$FF
+.byte $0F,$0F,$0F,$0F,$F0,$F0,$F0,$F0
+.byte $00,$00,$00,$00,$FF,$FF,$FF,$FF
+.byte $07,$07,$07,$07,$07,$F8,$F8,$F8
+.byte $00,$00,$00,$00,$00,$FF,$FF,$FF
+.byte $03,$03,$03,$03,$03,$03,$FC,$FC
+.byte $00,$00,$00,$00,$00,$00,$FF,$FF
+.byte $01,$01,$01,$01,$01,$01,$01,$FE
+.byte $00,$00,$00,$00,$00,$00,$00,$FF
+.byte $18,$3C,$FF,$FF,$7E,$7E,$7E,$7E
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$FF
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $80,$80,$80,$80,$80,$80,$80,$80
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $01,$01,$01,$01,$01,$01,$01,$01
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$03,$0C,$30,$C0
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $03,$0C,$30,$C0,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $C0,$30,$0C,$03,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$C0,$30,$0C,$03
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $10,$10,$20,$20,$40,$40,$80,$80
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $01,$01,$02,$02,$04,$04,$08,$08
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $80,$80,$40,$40,$20,$20,$10,$10
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $08,$08,$04,$04,$02,$02,$01,$01
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $01,$02,$04,$08,$10,$20,$40,$80
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $80,$40,$20,$10,$08,$04,$02,$01
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $81,$42,$24,$18,$18,$24,$42,$81
+.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $3C,$42,$81,$81,$81,$81,$42,$3C
+.byte $0C,$00,$10,$00,$00,$00,$04,$00
+.byte $0C,$00,$10,$3E,$2E,$2E,$2A,$2E
+.byte $00,$3C,$BC,$5A,$00,$20,$24,$7E
+.byte $18,$00,$80,$42,$18,$04,$00,$12
+.byte $00,$FF,$00,$FF,$00,$FF,$00,$FF
+.byte $55,$AA,$55,$AA,$55,$AA,$55,$AA
+.byte $24,$00,$5A,$00,$24,$00,$18,$00
+.byte $24,$00,$5A,$00,$24,$00,$18,$3C
+.byte $4D,$41,$00,$2E,$24,$24,$6A,$6E
+.byte $0C,$00,$10,$3E,$2E,$2E,$2A,$2E
+.byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$FF
+.byte $E7,$C3,$C3,$E7,$E7,$DB,$DB,$93
+.byte $24,$24,$C3,$08,$18,$C3,$24,$24
+.byte $18,$66,$42,$91,$89,$42,$66,$18
+.byte $18,$24,$00,$24,$00,$18,$00,$00
+.byte $24,$00,$5A,$00,$24,$00,$18,$3C
+.byte $5A,$36,$00,$00,$6C,$3B,$76,$00
+.byte $24,$7E,$54,$45,$48,$7E,$3E,$00
+.byte $00,$08,$14,$2A,$55,$2A,$14,$08
+.byte $80,$49,$36,$3E,$5D,$3E,$36,$49
+.byte $0F,$1F,$3F,$3D,$38,$38,$3C,$16
+.byte $0F,$1F,$3F,$3F,$3F,$3F,$3F,$17
+.byte $F0,$F8,$BC,$14,$A0,$A0,$08,$1C
+.byte $F0,$F8,$FC,$FC,$58,$58,$F8,$FC
+.byte $F2,$F1,$E1,$0F,$1F,$3B,$11,$00
+.byte $0D,$0E,$0E,$00,$00,$04,$0E,$0F
+.byte $00,$E0,$F0,$F0,$F8,$DC,$88,$00
+.byte $C0,$00,$00,$00,$00,$20,$70,$78
+.byte $F2,$F1,$E1,$1F,$3F,$13,$03,$00
+.byte $0D,$0E,$0E,$00,$00,$2C,$3C,$20
+.byte $00,$E0,$F0,$F8,$E0,$C0,$00,$00
+.byte $C0,$00,$00,$04,$1C,$3C,$1C,$00
+;;
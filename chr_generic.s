@@ -257,7 +257,7 @@
 .byte $00,$00,$76,$DC,$00,$00,$00,$00
 .byte $7F,$7F,$7F,$7F,$7F,$7F,$7F,$7F
 .byte $7E,$7E,$7E,$7E,$7E,$7E,$7E,$00
-.byte $00,$00,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$00,$00,$00,$00,$FF
 .byte $00,$00,$00,$00,$00,$00,$00,$00
 .byte $00,$00,$00,$00,$00,$00,$00,$00
 .byte $F0,$F0,$F0,$F0,$00,$00,$00,$00
@@ -289,12 +289,12 @@
 .byte $0F,$0F,$0F,$0F,$FF,$FF,$FF,$FF
 .byte $00,$00,$00,$00,$00,$00,$00,$00
 .byte $FF,$FF,$FF,$FF,$FF,$FF,$FF,$FF
-.byte $00,$00,$00,$00,$00,$00,$00,$00
-.byte $00,$00,$00,$00,$00,$00,$00,$00
-.byte $7F,$80,$80,$80,$80,$80,$80,$80
-.byte $FF,$00,$00,$00,$00,$00,$00,$00
-.byte $3F,$3F,$C0,$C0,$C0,$C0,$C0,$C0
-.byte $FF,$FF,$00,$00,$00,$00,$00,$00
+.byte $00,$00,$00,$24,$00,$81,$10,$42
+.byte $00,$00,$00,$24,$00,$81,$10,$42
+.byte $00,$00,$55,$00,$00,$00,$B6,$00
+.byte $00,$00,$55,$5D,$AD,$DD,$B6,$00
+.byte $00,$00,$DD,$00,$00,$00,$DB,$00
+.byte $00,$00,$DD,$EB,$DF,$BD,$DB,$00
 .byte $1F,$1F,$1F,$E0,$E0,$E0,$E0,$E0
 .byte $FF,$FF,$FF,$00,$00,$00,$00,$00
 .byte $0F,$0F,$0F,$0F,$F0,$F0,$F0,$F0
@@ -321,8 +321,8 @@
 .byte $00,$00,$00,$00,$00,$00,$FF,$FF
 .byte $01,$01,$01,$01,$01,$01,$01,$FE
 .byte $00,$00,$00,$00,$00,$00,$00,$FF
-.byte $00,$00,$00,$00,$00,$00,$00,$00
-.byte $FF,$00,$00,$00,$00,$00,$00,$00
+.byte $18,$3C,$FF,$FF,$7E,$7E,$7E,$7E
+.byte $10,$38,$FE,$7C,$38,$7C,$6C,$00
 .byte $00,$00,$00,$00,$00,$00,$00,$00
 .byte $00,$00,$00,$00,$00,$00,$00,$FF
 .byte $00,$00,$00,$00,$00,$00,$00,$00
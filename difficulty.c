@@ -0,0 +1,47 @@
+
+#include "neslib.h"
+#include "difficulty.h"
+
+// the old hardness counter (200, down 2 a row) changed tier every
+// 50 rows; the tiers keep that pace and the rest ramp up slower
+const byte diff_tier[DIFF_LEVELS] = {
+  0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3
+};
+// at least the tier's own gaps, at most LG_REACH_ROWS-1
+const byte diff_gap[DIFF_LEVELS] = {
+  1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3
+};
+const byte diff_keep[DIFF_LEVELS] = {
+  255, 255, 255, 240, 224, 224, 208, 208,
+  192, 192, 192, 176, 176, 160, 160, 160
+};
+const byte diff_broken[DIFF_LEVELS] = {
+  0, 0, 0, 8, 16, 16, 24, 32, 32, 40, 40, 48, 48, 56, 56, 64
+};
+const byte diff_item[DIFF_LEVELS] = {
+  192, 176, 160, 160, 144, 144, 128, 128,
+  112, 112, 96, 96, 96, 80, 80, 80
+};
+const byte diff_enemy[DIFF_LEVELS] = {
+  0, 4, 8, 10, 12, 14, 16, 16, 18, 20, 20, 22, 24, 24, 28, 32
+};
+
+byte diff_level;
+
+// rows left before the next level
+static byte diff_count;
+
+// back to level 0
+void difficulty_reset(void) {
+  diff_level = 0;
+  diff_count = DIFF_STEP;
+}
+
+// count a row climbed
+void difficulty_row(void) {
+  if (--diff_count) return;
+  diff_count = DIFF_STEP;
+  if (diff_level < DIFF_LEVELS-1) {
+    ++diff_level;
+  }
+}
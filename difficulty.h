@@ -0,0 +1,28 @@
+#ifndef _DIFFICULTY_H
+#define _DIFFICULTY_H
+
+#include "neslib.h"
+
+// difficulty by rows climbed: the level goes up every DIFF_STEP
+// rows, and each curve is a ROM table indexed by the level
+#define DIFF_LEVELS	16	// levels, the last one holds
+#define DIFF_STEP	25	// rows climbed per level
+
+extern byte diff_level;
+
+// the curves, one entry per level
+extern const byte diff_tier[DIFF_LEVELS];	// segment tier (levelgen)
+extern const byte diff_gap[DIFF_LEVELS];	// most empty rows in a row
+extern const byte diff_keep[DIFF_LEVELS];	// of 256 plain platforms kept
+extern const byte diff_broken[DIFF_LEVELS];	// of 256 plain ones broken
+extern const byte diff_item[DIFF_LEVELS];	// of 256 star rows with a star
+extern const byte diff_enemy[DIFF_LEVELS];	// of 256 empty rows with an enemy
+
+// back to level 0
+void difficulty_reset(void);
+
+// count a row climbed (called as each row is generated, which is
+// at most LOOKAHEAD rows before it scrolls in)
+void difficulty_row(void);
+
+#endif // difficulty.h
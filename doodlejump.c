@@ -8,6 +8,14 @@ draw_floor_line() function.
 The enemies use the same movement logic as the player, just
 with random inputs.
 */
+
+// MMC3 with 64 KB PRG, see mapper.h (0 and 2 banks for NROM)
+#define NES_MAPPER 4		// Mapper 4 (MMC3)
+#define NES_PRG_BANKS 4		// # of 16KB PRG banks
+#define NES_CHR_BANKS 1		// # of 8KB CHR banks
+//#resource "nesbanked.cfg"
+#define CFGFILE nesbanked.cfg
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -25,9 +33,74 @@ with random inputs.
 // VRAM update buffer
 #include "vrambuf.h"
 //#link "vrambuf.c"
+//#link "vramupd.s"
+
+// attribute table shadow
+#include "attrib.h"
+//#link "attrib.c"
+
+// split-screen status bar
+#include "hud.h"
+//#link "hud.c"
+
+// metasprite macros and rotating OAM allocation
+#include "sprites.h"
+//#link "sprites.c"
+//#link "sprfast.s"
+
+// table-driven metasprite animation
+#include "anim.h"
+//#link "anim.c"
+
+// playfield rows
+#include "platforms.h"
+
+// bank switching
+#include "mapper.h"
+//#link "mapper.s"
+
+// seedable random streams
+#include "rng.h"
+//#link "rng.c"
+//#link "rng.s"
+
+// difficulty curves by rows climbed
+#include "difficulty.h"
+//#link "difficulty.c"
+
+// table-driven level generator
+#include "levelgen.h"
+//#link "levelgen.c"
+//#link "segments.c"
+//#link "segdata.c"
+
+// enemies and other moving objects
+#include "actors.h"
+//#link "actors.c"
+
+// movement shared by the player and the jumpers
+#include "physics.h"
+//#link "physics.c"
+
+// the player's shots
+#include "shots.h"
+//#link "shots.c"
+
+// deferred game events
+#include "events.h"
+//#link "events.c"
+
+// direct APU sound effects
+#include "apu.h"
+//#link "apu.c"
+
+// palette fades and color cycles
+#include "palfx.h"
+//#link "palfx.c"
 
 // link the pattern table into CHR ROM
 //#link "chr_generic.s"
+//#link "chr_anim.s"
 
 // famitone2 library
 //#link "famitone2.s"
@@ -38,15 +111,10 @@ extern char demo_sounds[];
 
 
 
-#define COLS 30		// floor width in tiles
-#define ROWS 60		// total scrollable height in tiles
-#define JUMP_VEL 12
-
 #define MAX_FLOORS 20		// total # of floors in a stage
 #define GAPSIZE 4		// gap size in tiles
 #define BOTTOM_FLOOR_Y 2	// offset for bottommost floor
 
-#define MAX_ACTORS 8		// max # of moving actors
 #define SCREEN_Y_BOTTOM 208	// bottom of screen in pixels
 #define ACTOR_MIN_X 16		// leftmost position of actor
 #define ACTOR_MAX_X 228		// rightmost position of actor
@@ -61,33 +129,23 @@ extern char demo_sounds[];
 #define CH_ITEM 0xc4
 #define CH_BLANK 0x20
 #define CH_BASEMENT 0x97
+#define CH_DEBRIS 0x90
+#define CH_CRACK 0x91		// 0x91-0x92: cracked, without the glint
+#define CH_STAR 0xa0		// twinkles, see chr_anim.s
+
+#define ROW_UPD_BYTES 26	// worst-case buffer bytes of draw_platform()
+#define LOOKAHEAD 4		// rows generated ahead (power of 2)
+#define MAX_CRUMBLE 4		// broken platforms crumbling at once
+#define CRUMBLE_STEP 4		// frames each crumble frame is shown
+#define NO_ROW 0xff
 
-#define DEF_METASPRITE_2x2(name,code,pal)\
-const unsigned char name[]={\
-        0,      0,      (code)+0,   pal, \
-        0,      8,      (code)+1,   pal, \
-        8,      0,      (code)+2,   pal, \
-        8,      8,      (code)+3,   pal, \
-        128};
-
-#define DEF_METASPRITE_2x2_FLIP(name,code,pal)\
-const unsigned char name[]={\
-        8,      0,      (code)+0,   (pal)|OAM_FLIP_H, \
-        8,      8,      (code)+1,   (pal)|OAM_FLIP_H, \
-        0,      0,      (code)+2,   (pal)|OAM_FLIP_H, \
-        0,      8,      (code)+3,   (pal)|OAM_FLIP_H, \
-        128};
-
-
-DEF_METASPRITE_2x2(playerR, 0xe8, 0);
-DEF_METASPRITE_2x2_FLIP(playerL, 0xe8, 0);
 const char PALETTE[32] = { 
   0x03,			// screen color
 
-  0x11,0x30,0x27,0x0,	// background palette 0
-  0x1c,0x20,0x2c,0x0,	// background palette 1
-  0x00,0x10,0x20,0x0,	// background palette 2
-  0x06,0x16,0x26,0x0,   // background palette 3
+  0x11,0x30,0x27,0x0,	// background palette 0 (PAL_NORMAL)
+  0x1c,0x20,0x28,0x0,	// background palette 1 (PAL_ITEM)
+  0x04,0x14,0x24,0x0,	// background palette 2 (PAL_HAZARD)
+  0x06,0x16,0x26,0x0,   // background palette 3 (PAL_BROKEN)
 
   0x16,0x35,0x24,0x0,	// sprite palette 0
   0x00,0x37,0x25,0x0,	// sprite palette 1
@@ -96,33 +154,41 @@ const char PALETTE[32] = {
 };
 
 
-typedef struct Platform {
-  byte ypos;
-  byte xpos;
-  byte draw;
-  byte item;
-  byte broken;
-} Platform;
+// the player's shimmer after a star, on sprite palette 0 entry 1
+const byte STAR_SHIMMER[4] = { 0x28, 0x38, 0x30, 0x38 };
 
 Platform platforms[ROWS];
 
+// the tiles of a platform row: len tiles at column x, blanks around
+typedef struct Run {
+  byte x;
+  byte len;	// 0 = empty row
+  char tiles[4];
+} Run;
+
+// a row generated ahead of time, with its tiles built
+typedef struct Ahead {
+  Platform plat;
+  Run run;
+} Ahead;
+
+// rows waiting to scroll in, oldest at ahead_head
+Ahead ahead[LOOKAHEAD];
+byte ahead_head;
+byte ahead_count;
+Platform *ahead_below;	// the last row generated, in the queue or ring
+bool scrolled;		// a scroll step ran this frame
+
 int s;
 int spot;
 int curp;
 int prev_max;
-int player_score;
-char oam_id;
-byte doodlex, doodley, dy;
-int yvel, xvel;
+byte dy;
 int doodleplat;
-int hardness = 250;
-char doodlep;
+byte player_anim;	// animation state, see anim.h
 bool f = false;
-// random byte between (a ... b-1)
-// use rand() because rand8() has a cycle of 255
-byte rndint(byte a, byte b) {
-  return (rand() % (b-a)) + a;
-}
+byte redraw_row;	// static row spawn_mover() left to draw, or NO_ROW
+word rng_entropy;	// counts while waiting for a restart
 
 // return nametable address for tile (x,y)
 // assuming vertical scrolling (horiz. mirroring)
@@ -142,98 +208,51 @@ int get_floor_yy(byte floor) {
   return platforms[floor].ypos * 8;
 }
 
-void add_score(int score) {
-  player_score += score;
-  //draw_scoreboard();
-  //draw_score(player_score);
+void add_score(byte score) {
+  score_add(bcd_from_byte(score));
 }
 void draw_doodle() {
-  if (doodlep == 1){
-  	oam_id = oam_meta_spr(doodlex, doodley, oam_id, playerR);
-  }else if (doodlep == 0){
-      	oam_id = oam_meta_spr(doodlex, doodley, oam_id, playerL);
-
-  }
+  spr_meta4(actor_x[PLAYER], actor_y[PLAYER],
+            anim_sprite(player_anim, actor_state[PLAYER] & AS_RIGHT));
+  player_anim = anim_step(player_anim);
 }
 
 
 
+// fill in ring row i, the next row up, from the level tables
+// (with BANK_LEVEL in)
 void gen_platform(int i){
-  int td,rd,cd;
-  int spot,before,d; 
-
-  Platform *p;
-  Platform *prev;
-  before = 0;
-
-    cd = rand8();
-    td = rand8();
-    rd = rndint(1, 4);
-
-    p = &platforms[i];
-   // if (td <= hardness){
-    if (td <= 180){
-      //x = rndint(1, 2);
-      p->draw = 1;
-      p->xpos = rndint(3, 26);
-      if (rd==3) {
-      	p->item = 1;
-      }
-      if (rd > hardness ){
-        p->broken = 1;
-      }else{
-        p->broken = 0;
-      }
-    }
-    else{
-      p->draw = 0;
-      p->item = 0;
-    }
-
-    spot = i -1;
-
-  for (d=0; d<5; d++){
-     prev = &platforms[spot];
-    if(!prev->draw){
-      before ++;
-    }
-    if(p->xpos >= prev->xpos -3 && p->xpos <= prev->xpos + 3){
-      if (p->xpos >4){
-        p->xpos -=4;
-      }
-      else if(p->xpos < 23){
-        p->xpos += 4;
-      }
-    }
-    spot --;
-    if(spot <=0){
-      spot += 59;
-    }
-
-    if (i <=0){
-      i += 59;
-    }
-  }
-
-  if (before >= 3){
-    p->draw = 1;
-    p->xpos = rndint(3, 26);
-  }
-    if (i == 27){
-    p->draw = 1;
-    p->xpos = 14;
-  }
+  levelgen_row(&platforms[i]);
 }
 
 
+// fill the ring bottom to top: screen rows 31..0, then the rows
+// above the screen (59..32), which will scroll in from the top
 void create_platforms() {
-  byte i;
-  byte y = 26;
+  byte i, r, bank;
+  Platform *p;
+  bank = bank_push(BANK_LEVEL);
+  levelgen_reset();
   for (i=0; i<ROWS; i++) {
-    gen_platform(i);
-
+    r = ring_row(31 - i);
+    if (i != 31 - 27) {
+      gen_platform(r);
+      continue;
+    }
+    // the player starts on this one, and the rest climb from it
+    p = &platforms[r];
+    p->draw = 1;
+    p->broken = 0;
+    p->item = 0;
+    p->mover = 0;
+    p->xpos = 14;
+    levelgen_start(14);
   }
-
+  bank_pop(bank);
+  // the next row goes above the last one here
+  ahead_head = 0;
+  ahead_count = 0;
+  ahead_below = &platforms[ring_row(HUD_POS+HUD_ROWS)];
 }
 
 
@@ -271,80 +290,192 @@ void draw_platform(int i){
   }
   vrambuf_put(getntaddr(0,i),buf,COLS);
 }*/
+// draw len tiles at column x of a row, blank the rest with fills
+// (4+3+len+4 buffer bytes instead of 3+COLS)
+void draw_run(word addr, byte x, const char* tiles, byte len) {
+  vrambuf_fill(addr, ' ', x);
+  vrambuf_put(addr+x, tiles, len);
+  vrambuf_fill(addr+x+len, ' ', COLS-x-len);
+}
+
+// color the platform or star drawn on ring row r
+void paint_row_attrs(byte r) {
+  Platform *p = &platforms[r];
+  Platform *below = &platforms[r < ROWS-1 ? r+1 : 0];
+  if (p->draw == 1) {
+    attr_paint(p->xpos, 4, p->broken ? PAL_BROKEN : PAL_NORMAL);
+  } else if (below->draw == 1 && below->item == 1) {
+    attr_paint(below->xpos+1, 1, PAL_ITEM);
+  }
+}
+
+// build the tiles of row p: its platform, or the star of the
+// platform below it
+void build_run(Platform *p, Platform *below, Run *run) {
+  if (p->draw == 1) {
+    run->x = p->xpos;
+    run->len = 4;
+    run->tiles[0] = 0x83;
+    run->tiles[1] = p->broken ? 0x86 : 0x84;
+    run->tiles[2] = p->broken ? 0x87 : 0x84;
+    run->tiles[3] = 0x85;
+    below->item = 0;
+  } else if (below->draw == 1 && below->item == 1) {
+    run->x = below->xpos+1;
+    run->len = 1;
+    run->tiles[0] = CH_STAR;
+  } else {
+    run->len = 0;
+  }
+}
+
+// send the tiles and colors of ring row i
+void put_run(byte i, const Run *run) {
+  if (run->len) {
+    draw_run(getntaddr(0,i), run->x, run->tiles, run->len);
+  } else {
+    // empty row, one fill run instead of 30 literal spaces
+    vrambuf_fill(getntaddr(0,i), ' ', COLS);
+  }
+  // attribute cells span two rows, so paint both of the pair
+  attr_begin_row(i);
+  paint_row_attrs(i & ~1);
+  paint_row_attrs(i | 1);
+  attr_end_row();
+}
+
 void draw_platform(int i){
-  char buf[COLS];
-  byte j;
-  Platform *p = &platforms[i];
+  Run run;
   Platform *below;
-  if (i < 60) {
+  if (i < ROWS-1) {
     below = &platforms[i+1];
   } else {
     below = &platforms[0];
   }
-   memset(buf, ' ',COLS);
+  build_run(&platforms[i], below, &run);
+  put_run(i, &run);
+}
 
-  for (j = 0; j < COLS; j++){
-    if (p->draw == 1&& p->xpos == j && !p->broken){
-      buf[j] = 0x83;
-      buf[j+1] = 0x84;
-      buf[j+2] = 0x84;
-      buf[j+3] = 0x85;
-      j += 3;
-    }else if (p->draw == 1&& p->xpos == j){
-      buf[j] = 0x83;
-      buf[j+1] = 0x86;
-      buf[j+2] = 0x87;
-      buf[j+3] = 0x85;
-    }
-    
-  }
-  if(below->draw == 1 && below->item == 1 && p->draw != 1) {
-      buf[below->xpos+1] = 0x18;
-   } else if (p->draw == 1) {
-    below->item = 0;
+
+
+// crumble frames by timer / CRUMBLE_STEP, last one first
+const char CRUMBLE_TILES[4][4] = {
+  { CH_BLANK, CH_BLANK, CH_BLANK, CH_BLANK },
+  { CH_DEBRIS, CH_DEBRIS, CH_DEBRIS, CH_DEBRIS },
+  { CH_DEBRIS, CH_CRACK+1, CH_CRACK, CH_DEBRIS },
+  { CH_CRACK, CH_CRACK+1, CH_CRACK, CH_CRACK+1 },
+};
+
+// ring rows with a crumble timer running
+byte crumbling[MAX_CRUMBLE];
+byte num_crumbling;
+
+// start crumbling the (already not solid) platform on ring row r
+void crumble_start(byte r) {
+  if (num_crumbling == MAX_CRUMBLE) {
+    // too many at once, this one just vanishes
+    draw_platform(r);
+    return;
   }
-  vrambuf_put(getntaddr(0,i),buf,COLS);
+  platforms[r].crumble = CRUMBLE_STEP * 4;
+  crumbling[num_crumbling++] = r;
 }
 
+// advance the crumbling platforms, queueing one 4-tile run
+// for each whose frame changes (never waits for a flush)
+void crumble_update() {
+  byte i, r, t, pos;
+  Platform *p;
+  i = 0;
+  while (i < num_crumbling) {
+    r = crumbling[i];
+    p = &platforms[r];
+    pos = r + s;
+    if (pos >= ROWS) pos -= ROWS;
+    if (pos >= HUD_POS) {
+      // scrolled off the playfield, it will be regenerated
+      p->crumble = 0;
+    } else {
+      // out of buffer room, try again next frame
+      if (!VRAMBUF_ROOM(4)) break;
+      t = --p->crumble;
+      if (!(t & (CRUMBLE_STEP-1))) {
+        vrambuf_put(getntaddr(p->xpos, r), CRUMBLE_TILES[t / CRUMBLE_STEP], 4);
+      }
+    }
+    if (!p->crumble) {
+      crumbling[i] = crumbling[--num_crumbling];
+    } else {
+      ++i;
+    }
+  }
+}
 
-
+// land the player on a platform, posting what happens to it
+// (apply_events() does the scoring, sound and drawing)
 int check_floors_3(){
-  int i, end, top,p, ind;
+  byte ind;
   Platform *plat;
-  i = 1 - s;
-  if (i  < 0){
-    i += 60;
-  }
-  end = i + 27;
-  p = 0;
-  while (i < end){
-    if (i > 60){
-      ind = i - 60; 
-    }else{
-      ind = i;
+  ind = jumper_land(PLAYER);
+  if (ind == NO_FLOOR) {
+    return 0;
+  }
+  event_post(EV_BOUNCE, 0);
+  // moving platforms have no items and don't break
+  if (!(ind & FLOOR_ACTOR)) {
+    plat = &platforms[ind];
+    if (plat->item) {
+      event_post(EV_PICKUP, ind);
     }
-    top = (p) * 8;
-    if (platforms[ind].draw && yvel >= 0  &&doodley >= 60&& doodley <= top && doodley >= top - 16 && doodlex >= platforms[ind].xpos*8-8 && doodlex < (platforms[ind].xpos+3)*8){
-      if (platforms[ind].item) {
-        add_score(10);
-        plat = &platforms[ind];
-        plat->item = 0;
-        vrambuf_flush();
-        draw_platform(ind-1);
-      }
-      if (platforms[ind].broken){
-        plat = &platforms[ind];
-        plat->draw = 0;
-        vrambuf_flush();
-        draw_platform(ind);
-      }
-      return 1;
+    if (plat->broken) {
+      event_post(EV_BREAK, ind);
     }
-    
-    i ++;
-    p++;
   }
-  return 0;
+  return 1;
+}
+
+// apply queued events in order; one that needs more update buffer
+// than is left waits for the next frame, with those behind it
+// applying an event twice does nothing more
+void apply_events() {
+  byte r;
+  Platform *p;
+  while (event_count) {
+    r = event_arg[event_head];
+    p = &platforms[r];
+    switch (event_type[event_head]) {
+      case EV_PICKUP:
+        if (!VRAMBUF_ROOM(ROW_UPD_BYTES)) return;
+        if (p->item) {
+          p->item = 0;
+          add_score(10);
+          // the star is drawn on the row above its platform
+          draw_platform(r ? r-1 : ROWS-1);
+          palfx_cycle(0, 17, STAR_SHIMMER, 4, 3, 3);
+          APU_PULSE_DECAY(PULSE_CH1, 0x0a0, DUTY_25, 2, 4);
+        }
+        break;
+      case EV_BREAK:
+        if (!VRAMBUF_ROOM(ROW_UPD_BYTES)) return;
+        if (p->draw) {
+          p->draw = 0;
+          crumble_start(r);
+          APU_NOISE_DECAY(0x0c, 3, 0x20);
+        }
+        break;
+      case EV_BOUNCE:
+        APU_PULSE_DECAY(PULSE_CH0, 0x1c0, DUTY_50, 1, 2);
+        break;
+      case EV_DEATH:
+        f = true;
+        // white flash, back over the death animation
+        palfx_bright(PALFX_ALL, PALFX_WHITE);
+        palfx_fade(PALFX_ALL, PALFX_NORMAL, 3);
+        APU_NOISE_DECAY(0x0e, 10, 0x40);
+        break;
+    }
+    event_pop();
+  }
 }
 
 void detect_fall(){
@@ -354,18 +485,24 @@ void detect_fall(){
 
 
     for (i = 0; i < 30; i ++){
+      if (i == 13 || i == 15 || i == 17){
       memset(buf, ' ',COLS);
         if (i == 13){
         sprintf(&buf[9], "Game Over :(");
         }if (i == 15){
-        sprintf(&buf[10], "Score: %d", player_score); //enter %d and var name
+        sprintf(&buf[10], "Score: ");
+        score_digits(&buf[17]);
         }if (i == 17){
         sprintf(&buf[2], "Press down arrow to restart"); //enter %d and var name
         }
     vrambuf_put(getntaddr(0,i),buf,COLS);
+      } else {
+        // blank line, clear it with a fill run
+        vrambuf_fill(getntaddr(0,i),' ',COLS);
+      }
     vrambuf_flush();
         s = 0;
-    scroll(0, 479 - ((s) % 480));  
+    vrambuf_scroll(0, 479 - ((s) % 480));  
       
 
     }
@@ -376,97 +513,146 @@ void detect_fall(){
 
 }
 
-void update_offscreen(){
-   int p = 30 -s;
-   if (p <0){
-     p += 60;
-   }
-  gen_platform(p);
-  draw_platform(p);
-  hardness -= 2;
+// ring row at screen position pos (0 = top of the playfield)
+byte ring_row(int pos) {
+  pos -= s;
+  if (pos < 0) pos += ROWS;
+  if (pos >= ROWS) pos -= ROWS;
+  return pos;
+}
 
+// draw the status bar into the two rows just below the screen
+// the top of each frame shows them, see hud_scroll()
+void draw_hud() {
+  byte text = ring_row(HUD_POS);
+  byte line = ring_row(HUD_POS+1);
+  // no platforms live under the HUD
+  platforms[text].draw = 0;
+  platforms[text].item = 0;
+  platforms[line].draw = 0;
+  platforms[line].item = 0;
+  hud_draw(getntaddr(0,text), getntaddr(0,line));
 }
 
+// generate the next row into the look-ahead queue, if it has room
+// called in frames that don't scroll, so scroll steps don't pay
+// for the generator
+void ahead_fill() {
+  Ahead *a;
+  byte bank;
+  if (ahead_count == LOOKAHEAD) return;
+  a = &ahead[(ahead_head + ahead_count) & (LOOKAHEAD-1)];
+  bank = bank_push(BANK_LEVEL);
+  levelgen_row(&a->plat);
+  bank_pop(bank);
+  a->plat.crumble = 0;
+  build_run(&a->plat, ahead_below, &a->run);
+  ahead_below = &a->plat;
+  ++ahead_count;
+  difficulty_row();
+}
 
-void move_player() {
-  int oldp = curp;
-  int i;
-  byte joy = pad_poll(0);
-  if (joy & PAD_LEFT){
-    doodlex -= 3;
-    doodlep = 0;
+void update_offscreen(){
+  // the HUD rows sit between the screen and the new row
+  byte p = ring_row(HUD_POS+HUD_ROWS);
+  Ahead *a;
+  // scrolling faster than the idle frames fill: generate it now
+  if (!ahead_count) {
+    ahead_fill();
   }
-  if (joy & PAD_RIGHT){
-    doodlex += 3;
-    doodlep = 1;
+  a = &ahead[ahead_head];
+  platforms[p] = a->plat;
+  if (ahead_below == &a->plat) {
+    ahead_below = &platforms[p];
   }
-  doodlex += xvel;
-  if (doodley += yvel > 50){
-    
-  	doodley += yvel/2;
-    
-  }else{
-    yvel = 10;
-    doodley += yvel/2;
-          for (i = s*8; i <  (s+1)*8 ; i++){
-        scroll(0, 479 - ((i) % 480));  
-        
-      }
-      s += 1;
-      update_offscreen();
-      if (s >=60){
-        s = 0;
-      }
+  ahead_head = (ahead_head + 1) & (LOOKAHEAD-1);
+  --ahead_count;
+  put_run(p, &a->run);
+  draw_hud();
+}
 
+// start a moving platform for a row at screen y
+void spawn_mover(byte row, byte y) {
+  Platform *p = &platforms[row];
+  byte i = actor_spawn(AT_MOVER, p->xpos*8, y, row);
+  if (i != NO_ACTOR) {
+    // direction from the layout, not from a random stream
+    actor_vx[i] = (p->xpos & 1) ? 1 : -1;
+  } else {
+    // pool full, keep it as a static platform; this runs in
+    // scroll_step(), so it's drawn later, when the buffer has room
+    p->mover = 0;
+    if (redraw_row == NO_ROW) {
+      p->draw = 1;
+      redraw_row = row;
+    }
   }
+}
 
-  yvel += 1;
-  
-      if(doodley < 100 && yvel > 0 ){
-      for (i = s*8; i <  (s+1)*8 ; i++){
-        scroll(0, 479 - ((i) % 480));  
-        doodley += 1;
-        
-      }
-      s += 1;
-      update_offscreen();
-      if (s >=60){
-        s = 0;
-      }
-      //  doodley += 8;
-    }
+// maybe start an actor on the ring row about to enter at the top
+void spawn_actors(byte row) {
+  byte i, x;
+  if (platforms[row].mover) {
+    spawn_mover(row, 248);
+    return;
+  }
+  if (platforms[row].draw ||
+      rng_next(RNG_ENEMIES) >= diff_enemy[diff_level]) return;
+  x = 16 + rng_range(RNG_ENEMIES, 208);
+  if (rng_next(RNG_ENEMIES) & 1) {
+    // jumpers fall onto the platforms below, not tied to a row
+    actor_spawn(AT_JUMPER, x, 248, NO_ACTOR);
+    return;
+  }
+  i = actor_spawn(AT_UFO, x, 248, row);
+  if (i != NO_ACTOR) {
+    actor_vx[i] = (rng_next(RNG_ENEMIES) & 1) ? 1 : -1;
+  }
+}
 
-  //if (yvel >= JUMP_VEL){ //check floors
-  if (check_floors_3()){
-    yvel = -1 *JUMP_VEL;
+// scroll the playfield up one row and generate the next row
+void scroll_step() {
+  hud_scroll(479 - ((s*8 + 7) % 480));
+  s += 1;
+  scrolled = true;
+  update_offscreen();
+  if (s >=60){
+    s = 0;
+  }
+  actors_scroll(ring_row(HUD_POS));
+  shots_scroll();
+  spawn_actors(ring_row(ROWS-1));
+}
 
-   
-    
+
+void move_player() {
+  // pinned at the top of the screen: push down and scroll instead
+  if (actor_y[PLAYER] == 0) {
+    actor_vy[PLAYER] = 10;
+    scroll_step();
   }
-  if (doodley > prev_max) {
-    add_score((word) doodley - prev_max);
-    prev_max = doodley;
+  // A fires on the press, not while held
+  if (pad_trigger(0) & PAD_A) {
+    shot_fire(actor_x[PLAYER] + 4, actor_y[PLAYER] - 8);
   }
-  /*while (doodley ==0){
-
-     for (i = s*8; i <  (s+1)*8 ; i++){
-        scroll(0, 479 - ((i) % 480));  
-      }
-      s += 1;
-      if (s >=60){
-        s = 0;
-      }
-    yvel +=1;
-    doodley +=5;
-    
-  }*/
-  if (doodley >= 212){
-    f = true;
+  jumper_step(PLAYER, pad_state(0));
+  if (actor_y[PLAYER] < 100 && actor_vy[PLAYER] > 0) {
+    scroll_step();
+    actor_y[PLAYER] += 8;
   }
-  
-  //yvel +=1;
-  
 
+  if (check_floors_3()){
+    player_anim = ANIM_START(ANIM_CROUCH);
+  } else if (actor_vy[PLAYER] > 0 && ANIM_ENTRY(player_anim) != ANIM_FALL) {
+    player_anim = ANIM_START(ANIM_FALL);
+  }
+  if (actor_y[PLAYER] > prev_max) {
+    add_score((byte) (actor_y[PLAYER] - prev_max));
+    prev_max = actor_y[PLAYER];
+  }
+  if (actor_y[PLAYER] >= 212){
+    event_post(EV_DEATH, 0);
+  }
 }
 
 
@@ -518,6 +704,8 @@ void clear_platforms(){
   for (i=0; i < ROWS; i++){
      p = &platforms[i];
      p->draw = 0;
+     p->mover = 0;
+     p->crumble = 0;
      p->xpos = 0;
   }
   s = 0;
@@ -556,6 +744,8 @@ void scroll_demo2() {
 }
 void detect_reset(){
   byte joy = pad_poll(0);
+  // how long the player waits seeds the next game
+  ++rng_entropy;
   if (joy & PAD_DOWN){
     f = false;
   }
@@ -564,44 +754,108 @@ void detect_reset(){
 // set up PPU
 void setup_graphics() {
   ppu_off();
-  oam_clear();
+  spr_clear();
   pal_all(PALETTE);
+  palfx_init(PALETTE);
   vram_adr(0x2000);
   vram_fill(CH_BLANK, 0x1000);
-  vrambuf_clear();
-  set_vram_update(updbuf);
+  attr_clear();
+  vrambuf_init_nmi();
   ppu_on_all();
 }
 
 void gameloop(){
     int s = 0;
     bool reset = false;
+    byte i;
 
   //setup_sounds();		// init famitone library
-  hardness = 200;
+  // black before anything is drawn, faded in once the level is up
+  palfx_bright(PALFX_ALL, PALFX_BLACK);
+  palfx_wait();
+  difficulty_reset();
+  rng_seed(rng_entropy ^ nesclock());
   create_platforms();
 
   draw_platforms();
   //print_table();
   spot = 0;
-  doodlex = 120;
-  doodley = SCREEN_Y_BOTTOM-10;
-  doodlep = 0;
+  actor_x[PLAYER] = 120;
+  actor_y[PLAYER] = SCREEN_Y_BOTTOM-10;
+  actor_state[PLAYER] = 0;
+  player_anim = ANIM_START(ANIM_IDLE);
   dy = 0;
-  yvel = -1 * JUMP_VEL;
-  player_score = 0;
-  prev_max = doodley;
+  actor_vy[PLAYER] = -1 * JUMP_VEL;
+  score_reset();
+  actors_clear();
+  shots_clear();
+  redraw_row = NO_ROW;
+  events_clear();
+  num_crumbling = 0;
+  // moving platforms already on screen
+  for (i = 0; i < HUD_POS; i++) {
+    if (platforms[ring_row(i)].mover) {
+      spawn_mover(ring_row(i), i*8);
+    }
+  }
+  prev_max = actor_y[PLAYER];
 
   draw_platforms();
+  draw_hud();
+  hud_scroll(0);
+  palfx_fade(PALFX_ALL, PALFX_NORMAL, 4);
   while(!f){
-    oam_id = 0;
+    // wait for vblank, sending last frame's updates once
+    vrambuf_flush();
+    chr_anim_tick();
+
+    // OAM work is bounded, so it overlaps the wait for sprite 0
+    // (actors are drawn after the split, their cost varies)
+    spr_begin();
+    hud_sprite0();
     draw_doodle();
 
-    move_player();
+    hud_split();
 
-    oam_hide_rest(oam_id);
+    move_player();
+    if (redraw_row != NO_ROW && VRAMBUF_ROOM(ROW_UPD_BYTES)) {
+      draw_platform(redraw_row);
+      redraw_row = NO_ROW;
+    }
+    crumble_update();
+    actors_update();
+    i = shots_update();
+    if (i) {
+      add_score(i * 25);
+    }
+    if (actors_hit(actor_x[PLAYER], actor_y[PLAYER]) != NO_ACTOR) {
+      event_post(EV_DEATH, 0);
+    }
+    apply_events();
+    shots_draw();
+    actors_draw();
+    spr_end();
+    hud_update_score();
+    palfx_update();
+    // spare time in frames without a scroll step: generate ahead
+    if (!scrolled) {
+      ahead_fill();
+    }
+    scrolled = false;
+  }
 
-    ppu_wait_frame();
+  // hold the death animation for a moment
+  player_anim = ANIM_START(ANIM_DEATH);
+  for (i = 0; i < 48; i++) {
+    vrambuf_flush();
+    chr_anim_tick();
+    spr_begin();
+    hud_sprite0();
+    draw_doodle();
+    hud_split();
+    actors_draw();
+    spr_end();
+    palfx_update();
   }
 
   detect_fall();
@@ -613,12 +867,53 @@ void gameloop(){
 }
 
 
+#ifdef SPR_BENCH
+// show 2x2 metasprites written per frame by each writer, then halt
+void bench_sprites() {
+  char buf[COLS];
+  byte w;
+  for (w = 0; w < 3; w++) {
+    memset(buf, ' ', COLS);
+    sprintf(buf, "writer %d: %u per frame", w,
+            spr_bench(w, anim_sprite(ANIM_START(ANIM_IDLE), 1)));
+    vrambuf_put(NTADR_A(1, 4+w*2), buf, COLS-2);
+  }
+  vrambuf_flush();
+  while (1) ;
+}
+#endif
+
+#ifdef ACTOR_BENCH
+// show jumpers updated and drawn per frame with 4 and 8 active, then halt
+void bench_actors() {
+  char buf[COLS];
+  byte n;
+  rng_seed(1);
+  create_platforms();
+  draw_platforms();
+  for (n = 4; n <= MAX_ACTORS; n += 4) {
+    memset(buf, ' ', COLS);
+    sprintf(buf, "%d jumpers: %u per frame", n, actors_bench(n));
+    vrambuf_put(NTADR_A(1, n), buf, COLS-2);
+  }
+  vrambuf_flush();
+  while (1) ;
+}
+#endif
+
 // main program
 void main() {
 
 
+    mapper_init();
+    apu_init();
     setup_graphics();
-    create_platforms();
+#ifdef SPR_BENCH
+    bench_sprites();
+#endif
+#ifdef ACTOR_BENCH
+    bench_actors();
+#endif
   while (1) {
 
     gameloop();
@@ -0,0 +1,30 @@
+
+#include "neslib.h"
+#include "events.h"
+
+byte event_type[MAX_EVENTS];
+byte event_arg[MAX_EVENTS];
+byte event_head;
+byte event_count;
+
+// empty the queue
+void events_clear(void) {
+  event_head = 0;
+  event_count = 0;
+}
+
+// queue an event, dropped when the queue is full
+void event_post(byte type, byte arg) {
+  byte i;
+  if (event_count == MAX_EVENTS) return;
+  i = (event_head + event_count) & (MAX_EVENTS-1);
+  event_type[i] = type;
+  event_arg[i] = arg;
+  ++event_count;
+}
+
+// remove the oldest event
+void event_pop(void) {
+  event_head = (event_head + 1) & (MAX_EVENTS-1);
+  --event_count;
+}
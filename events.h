@@ -0,0 +1,30 @@
+#ifndef _EVENTS_H
+#define _EVENTS_H
+
+#include "neslib.h"
+
+// game events, posted where they are detected (collision)
+// and applied later in the frame, see apply_events()
+#define EV_PICKUP	1	// arg = ring row of the item's platform
+#define EV_BREAK	2	// arg = ring row of the broken platform
+#define EV_BOUNCE	3	// arg unused
+#define EV_DEATH	4	// arg unused
+
+#define MAX_EVENTS	8	// queue capacity (power of 2)
+
+// queued events, oldest at event_head
+extern byte event_type[MAX_EVENTS];
+extern byte event_arg[MAX_EVENTS];
+extern byte event_head;
+extern byte event_count;
+
+// empty the queue
+void events_clear(void);
+
+// queue an event, dropped when the queue is full
+void event_post(byte type, byte arg);
+
+// remove the oldest event (event_type[event_head])
+void event_pop(void);
+
+#endif // events.h
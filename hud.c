@@ -0,0 +1,109 @@
+
+#include "neslib.h"
+#include "vrambuf.h"
+#include "hud.h"
+#include "bcd.h"
+
+// playfield scroll, 0..479
+static word play_y;
+
+// nametable address of the HUD text row
+static word hud_text;
+
+// score as packed BCD, [0] holds the 4 lowest digits
+word score_bcd[2];
+
+// one bit per digit not yet on screen, bit 0 = lowest digit
+static byte score_dirty;
+
+// set score to zero
+void score_reset(void) {
+  score_bcd[0] = 0;
+  score_bcd[1] = 0;
+  score_dirty = 0xff;
+}
+
+// return a bit per changed digit of a 4-digit BCD word
+static byte dirty_digits(word diff) {
+  byte d = 0;
+  if (diff & 0x000f) d |= 1;
+  if (diff & 0x00f0) d |= 2;
+  if (diff & 0x0f00) d |= 4;
+  if (diff & 0xf000) d |= 8;
+  return d;
+}
+
+// add a packed BCD amount (0..0x5999) and mark changed digits
+void score_add(word bcd) {
+  word old = score_bcd[0];
+  word sum = bcd_add(old, bcd);
+  // bcd_add() lets the top digit run past 9, carry it by hand
+  if (sum >= 0xa000) {
+    sum -= 0xa000;
+    old = score_bcd[1];
+    score_bcd[1] = bcd_add(old, 1);
+    score_dirty |= dirty_digits(old ^ score_bcd[1]) << 4;
+    old = score_bcd[0];
+  }
+  score_bcd[0] = sum;
+  score_dirty |= dirty_digits(old ^ sum);
+}
+
+// write SCORE_DIGITS digit tiles, most significant first
+void score_digits(char* buf) {
+  byte i;
+  word w;
+  for (i=0; i<SCORE_DIGITS; i++) {
+    w = score_bcd[i < 4];
+    buf[i] = '0' + ((w >> ((3 - (i & 3)) << 2)) & 0xf);
+  }
+}
+
+// place sprite 0 in OAM slot 0 (outside the rotating slots)
+void hud_sprite0(void) {
+  oam_spr(HUD_SPR0_X, HUD_SPR0_Y, CH_HUDLINE, OAM_BEHIND, 0);
+}
+
+// set playfield scroll (0..479)
+void hud_scroll(word y) {
+  play_y = y;
+  // the HUD rows are HUD_POS rows below the top of the playfield
+  y += HUD_POS*8;
+  if (y >= 480) y -= 480;
+  vrambuf_scroll(0, y);
+}
+
+// wait for sprite 0 and switch to the playfield scroll
+void hud_split(void) {
+  // the first playfield line shown is the one under the HUD
+  word y = play_y + HUD_ROWS*8;
+  if (y >= 480) y -= 480;
+  splitxy(0, y);
+}
+
+// draw the HUD text row and separator row
+void hud_draw(word text, word line) {
+  char buf[SCORE_DIGITS];
+  hud_text = text;
+  score_digits(buf);
+  vrambuf_fill(text, ' ', 30);
+  vrambuf_put(text+1, "SCORE", 5);
+  vrambuf_put(text+HUD_SCORE_X, buf, SCORE_DIGITS);
+  vrambuf_fill(line, CH_HUDLINE, 30);
+  score_dirty = 0;
+}
+
+// queue only the score digits changed since the last draw
+void hud_update_score(void) {
+  char buf[SCORE_DIGITS];
+  byte first, last;
+  if (!score_dirty) return;
+  // bit 7 is the leftmost digit on screen
+  for (first=0; !(score_dirty & (0x80 >> first)); first++) ;
+  for (last=SCORE_DIGITS-1; !(score_dirty & (0x80 >> last)); last--) ;
+  // no room left this frame: keep the digits dirty for the next
+  if (!VRAMBUF_ROOM(last-first+1)) return;
+  score_digits(buf);
+  vrambuf_put(hud_text+HUD_SCORE_X+first, buf+first, last-first+1);
+  score_dirty = 0;
+}
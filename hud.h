@@ -0,0 +1,62 @@
+
+#ifndef _HUD_H
+#define _HUD_H
+
+#include "neslib.h"
+
+// the status bar is two tile rows at the top of the screen
+// row 0 holds the text, row 1 a separator line for sprite 0
+#define HUD_ROWS	2
+
+// nametable rows holding the HUD, counted from the top of the
+// playfield: the two rows just below the visible screen
+#define HUD_POS		30
+
+// separator tile, opaque only on its bottom pixel row
+// also used as the sprite 0 tile
+#define CH_HUDLINE	0x80
+
+// sprite 0 sits on the separator line (hit on scanline 15), over
+// column 29: the separator is only drawn in columns 0..29, and
+// with no opaque background pixel under it there's no hit
+#define HUD_SPR0_X	232
+#define HUD_SPR0_Y	7
+
+// place sprite 0 in OAM slot 0 (outside the rotating slots)
+void hud_sprite0(void);
+
+// set playfield scroll (0..479)
+// the top of the frame shows the HUD rows instead
+void hud_scroll(word y);
+
+// wait for sprite 0 and switch to the playfield scroll
+// must be called every frame before scanline 15
+void hud_split(void);
+
+// score digits shown, all packed BCD
+#define SCORE_DIGITS	8
+
+// column of the first score digit
+#define HUD_SCORE_X	7
+
+// score as packed BCD, [0] holds the 4 lowest digits
+extern word score_bcd[2];
+
+// set score to zero
+void score_reset(void);
+
+// add a packed BCD amount (0..0x5999) and mark changed digits
+void score_add(word bcd);
+
+// write SCORE_DIGITS digit tiles, most significant first
+void score_digits(char* buf);
+
+// draw the HUD text row and separator row
+void hud_draw(word text, word line);
+
+// queue only the score digits changed since the last draw
+// 3+n buffer bytes for n digits, nothing if unchanged or if they
+// don't fit (they stay dirty for the next frame)
+void hud_update_score(void);
+
+#endif // hud.h
@@ -0,0 +1,157 @@
+
+#include "neslib.h"
+#include "platforms.h"
+#include "rng.h"
+#include "difficulty.h"
+#include "levelgen.h"
+#include "segments.h"
+#include "mapper.h"
+
+// in the level code bank (BANK_LEVEL), see mapper.h
+#if NES_MAPPER == 4
+#pragma code-name ("CODE0")
+#pragma rodata-name ("RODATA0")
+#endif
+
+// row bytes, listed bottom to top
+#define __	LG_EMPTY
+#define PL(x)	(LG_PLAIN << 5 | (x))
+#define BR(x)	(LG_BROKEN << 5 | (x))
+#define IT(x)	(LG_ITEM << 5 | (x))
+#define MV(x)	(LG_MOVER << 5 | (x))
+
+// tier 0: at most 1 empty row, plain platforms and stars
+const byte seg00[] = { PL(12), __, PL(6), __, PL(14), __, PL(20), LG_END };
+const byte seg01[] = { PL(4), __, PL(10), __, PL(16), __, PL(22), __, PL(16), LG_END };
+const byte seg02[] = { PL(20), __, PL(14), IT(8), __, PL(14), LG_END };
+const byte seg03[] = { PL(8), PL(15), __, PL(11), __, PL(5), LG_END };
+const byte seg04[] = { PL(14), __, PL(14), __, PL(9), __, PL(17), LG_END };
+const byte seg05[] = { PL(22), __, PL(17), __, IT(12), __, PL(7), LG_END };
+const byte seg06[] = { PL(3), __, PL(9), __, PL(3), __, PL(9), LG_END };
+const byte seg07[] = { PL(16), __, PL(24), __, PL(18), __, PL(12), LG_END };
+
+// tier 1: at most 2 empty rows, some broken and moving
+const byte seg10[] = { PL(10), __, __, PL(16), __, BR(22), PL(14), LG_END };
+const byte seg11[] = { PL(5), __, __, PL(12), __, __, PL(19), LG_END };
+const byte seg12[] = { PL(18), __, MV(10), __, __, PL(16), LG_END };
+const byte seg13[] = { PL(22), __, IT(15), __, __, PL(9), LG_END };
+const byte seg14[] = { PL(8), __, BR(14), __, PL(6), __, __, PL(13), LG_END };
+const byte seg15[] = { PL(12), __, __, PL(20), __, __, PL(13), LG_END };
+const byte seg16[] = { PL(25), __, PL(18), __, __, MV(12), __, PL(6), LG_END };
+const byte seg17[] = { PL(4), __, __, PL(11), BR(19), __, PL(11), LG_END };
+
+// tier 2: at most 2 empty rows, more broken and moving
+const byte seg20[] = { PL(10), __, __, BR(16), __, __, PL(22), LG_END };
+const byte seg21[] = { MV(14), __, __, PL(8), __, __, MV(14), LG_END };
+const byte seg22[] = { PL(20), __, BR(13), __, BR(6), __, PL(12), LG_END };
+const byte seg23[] = { PL(5), __, __, IT(12), __, __, PL(19), LG_END };
+const byte seg24[] = { PL(16), __, MV(9), __, __, BR(15), __, PL(22), LG_END };
+const byte seg25[] = { PL(24), __, __, PL(17), __, __, BR(10), PL(16), LG_END };
+const byte seg26[] = { PL(3), __, BR(10), __, __, PL(17), __, PL(10), LG_END };
+const byte seg27[] = { PL(13), __, __, MV(13), __, __, PL(13), LG_END };
+
+// tier 3: at most 3 empty rows
+const byte seg30[] = { PL(12), __, __, __, PL(19), __, __, BR(12), __, PL(5), LG_END };
+const byte seg31[] = { PL(6), __, __, __, MV(12), __, __, __, PL(18), LG_END };
+const byte seg32[] = { PL(20), __, __, BR(13), __, __, __, PL(8), LG_END };
+const byte seg33[] = { PL(15), __, __, __, IT(22), __, __, PL(15), LG_END };
+const byte seg34[] = { PL(9), __, PL(16), __, __, __, BR(23), __, PL(17), LG_END };
+const byte seg35[] = { PL(4), __, __, MV(10), __, __, __, PL(16), LG_END };
+const byte seg36[] = { PL(22), __, __, __, PL(15), __, __, __, PL(8), LG_END };
+const byte seg37[] = { PL(11), __, BR(17), __, __, BR(11), __, __, PL(18), LG_END };
+
+const byte* const lg_segments[LG_TIERS][LG_SEGS] = {
+  { seg00, seg01, seg02, seg03, seg04, seg05, seg06, seg07 },
+  { seg10, seg11, seg12, seg13, seg14, seg15, seg16, seg17 },
+  { seg20, seg21, seg22, seg23, seg24, seg25, seg26, seg27 },
+  { seg30, seg31, seg32, seg33, seg34, seg35, seg36, seg37 },
+};
+
+static const byte lg_none[] = { LG_END };
+
+// tiles sideways a jump reaches a platform 1..LG_REACH_ROWS rows up
+// from: 3 pixels a frame for the frames until it can land there
+// (20, 17, 12, 12), plus most of the 32-pixel landing width
+const byte lg_reach[LG_REACH_ROWS+1] = { 0, 10, 9, 7, 7 };
+
+// next row of the current segment
+static const byte* lg_next = lg_none;
+static byte lg_authored;	// reading an authored segment (seg_row())
+
+// last platform, and empty rows generated above it
+static byte lg_anchor = 14;
+static byte lg_gap;
+
+// start a new segment on the next row
+void levelgen_reset(void) {
+  lg_next = lg_none;
+  lg_authored = 0;
+}
+
+// start a new segment above a platform placed by hand at xpos
+void levelgen_start(byte xpos) {
+  lg_next = lg_none;
+  lg_authored = 0;
+  lg_anchor = xpos;
+  lg_gap = 0;
+}
+
+// next row byte of the current segment
+static byte lg_read(void) {
+  if (lg_authored) return seg_row();
+  return *lg_next++;
+}
+
+// fill in the next row up from the current segment
+void levelgen_row(Platform* p) {
+  byte lv = diff_level;
+  byte tier = diff_tier[lv];
+  byte b = lg_read();
+  byte x, reach;
+  if (b == LG_END) {
+    // a new segment from the tier of the current level, sometimes
+    // an authored one from this tier or below
+    lg_authored = rng_next(RNG_LAYOUT) < LG_AUTHORED && seg_tier_count[tier];
+    if (lg_authored) {
+      seg_begin(rng_range(RNG_LAYOUT, seg_tier_count[tier]));
+    } else {
+      lg_next = lg_segments[tier][rng_next(RNG_LAYOUT) & (LG_SEGS-1)];
+    }
+    b = lg_read();
+  }
+  x = b & 31;
+  b >>= 5;
+  // thin out plain platforms, harden the rest (not in authored ones)
+  if (b == LG_PLAIN && !lg_authored) {
+    if (rng_next(RNG_LAYOUT) > diff_keep[lv]) {
+      b = LG_EMPTY;
+    } else if (rng_next(RNG_LAYOUT) < diff_broken[lv]) {
+      b = LG_BROKEN;
+    }
+  }
+  if (b == LG_EMPTY) {
+    // keep it empty unless the gap would get too big
+    if (lg_gap < diff_gap[lv]) {
+      ++lg_gap;
+      p->xpos = x;
+      p->draw = p->broken = p->item = p->mover = 0;
+      return;
+    }
+    // where the dropped one was, or straight above the last one
+    b = LG_PLAIN;
+    if (!x) x = lg_anchor;
+  }
+  // move it within reach of the last platform
+  reach = lg_reach[lg_gap+1];
+  if (x > lg_anchor + reach) x = lg_anchor + reach;
+  if (x + reach < lg_anchor) x = lg_anchor - reach;
+  lg_anchor = x;
+  lg_gap = 0;
+  p->xpos = x;
+  p->draw = (b == LG_PLAIN || b == LG_BROKEN || b == LG_ITEM);
+  p->broken = (b == LG_BROKEN);
+  // stars come from their own stream, so they don't move platforms
+  p->item = (b == LG_ITEM &&
+             (lg_authored || rng_next(RNG_ITEMS) < diff_item[lv]));
+  p->mover = (b == LG_MOVER);
+}
@@ -0,0 +1,51 @@
+#ifndef _LEVELGEN_H
+#define _LEVELGEN_H
+
+#include "neslib.h"
+#include "platforms.h"
+
+// rows come from ROM segments of a few rows each, picked at random
+// from the table of the current difficulty tier (diff_tier[]), then
+// thinned out and broken by the other difficulty curves; now and
+// then a longer authored segment (segments.h) is played as drawn,
+// its stars always there; segments are
+// checked by hand to be climbable on their own and when joined:
+//   - they start and end with a plain or moving platform
+//   - at most diff_gap[] empty rows between platforms in a tier,
+//     and 8 tiles sideways (a jump rises ~36 pixels, 4.5 rows)
+//   - a star platform has an empty row above it (the star's row)
+// levelgen_row() also keeps every row reachable from the last
+// platform, so joins between segments can't strand the player:
+// a platform out of sideways reach is moved in, and a platform is
+// added when the next empty row would be out of jump height
+
+// one byte per row: type << 5 | xpos (3..25)
+#define LG_EMPTY	0
+#define LG_PLAIN	1
+#define LG_BROKEN	2
+#define LG_ITEM		3	// plain, maybe a star on the row above
+#define LG_MOVER	4	// moving platform, see spawn_actors()
+#define LG_END		0xff	// end of a segment
+
+#define LG_TIERS	4	// difficulty tiers
+#define LG_SEGS		8	// segments per tier (power of 2)
+#define LG_REACH_ROWS	4	// highest platform a jump lands on, in rows
+#define LG_AUTHORED	40	// of 256 new segments that are authored
+				// ones (segments.txt), when the tier has any
+
+// start a new segment on the next row
+void levelgen_reset(void);
+
+// start a new segment above a platform placed by hand at xpos
+void levelgen_start(byte xpos);
+
+// fill in the next row up from the current segment
+void levelgen_row(Platform* p);
+
+// approximate cycles per row (cc65): ~120, ~190 when a new
+// segment starts (rng_next() and two table reads), plus ~60 for the
+// difficulty curves
+// the old per-row gen_platform() was ~3500 (two rand() % n,
+// a five-row look-back with int math)
+
+#endif // levelgen.h
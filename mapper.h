@@ -0,0 +1,63 @@
+#ifndef _MAPPER_H
+#define _MAPPER_H
+
+#include "neslib.h"
+
+// cartridge board; doodlejump.c sets these for the iNES header,
+// the other files get the same values from here
+//   0: NROM, 32 KB PRG, no banks (the bank calls do nothing)
+//   4: MMC3, NES_PRG_BANKS x 16 KB PRG (nesbanked.cfg)
+#ifndef NES_MAPPER
+#define NES_MAPPER 4
+#endif
+
+// MMC3 memory map (PRG mode 0, see nesbanked.cfg):
+//   $8000-$9FFF  code bank, bank_push()/bank_pop()   banks 0..2
+//   $A000-$BFFF  data bank, bank_data()              banks 3..5
+//   $C000-$FFFF  fixed: startup, neslib, the NMI, the main loop
+//                and everything it calls every frame
+// the NMI doesn't switch banks; code in a bank may only be called
+// from the fixed bank, through a bank_push() around the call
+
+#define BANK_LEVEL	0	// levelgen.c, segments.c, segdata.c
+
+#if NES_MAPPER == 4
+
+// bank at $8000 and at $A000
+extern byte bank_8000;
+extern byte bank_a000;
+
+// mirroring, IRQ off, CHR in order (the reset stub in mapper.s has
+// already put bank 0 at $8000 and 3 at $A000)
+// call first thing in main()
+void mapper_init(void);
+
+// animate the background: tiles $80-$bf come from one of the four
+// 1 KB frames in chr_anim.s, the next one every 8 calls
+// call once a frame, after vrambuf_flush() (in vblank, so the
+// switch doesn't land partway down the animated tiles)
+void chr_anim_tick(void);
+
+// put code bank b at $8000, returning the one it replaces
+// ~55 cycles, with bank_pop() ~85 cycles around a far call: the
+// generator (~600 cycles a row in ahead_fill()) costs ~13% more,
+// create_platforms() switches once for its 60 rows
+byte __fastcall__ bank_push(byte b);
+
+// put back the code bank bank_push() returned (~30 cycles)
+void __fastcall__ bank_pop(byte b);
+
+// put data bank b at $A000 (~30 cycles)
+void __fastcall__ bank_data(byte b);
+
+#else
+
+#define mapper_init()
+#define bank_push(b) 0
+#define bank_pop(b)
+#define bank_data(b)
+#define chr_anim_tick()
+
+#endif
+
+#endif // mapper.h
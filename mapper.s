@@ -0,0 +1,136 @@
+;MMC3 bank switching, see mapper.h
+;every bank write selects a register at $8000 then writes it at $8001,
+;so nothing that runs in between (the NMI) may switch banks
+
+	.export _mapper_init
+	.export _bank_push,_bank_pop,_bank_data
+	.export _bank_8000,_bank_a000
+	.export _chr_anim_tick
+	.import __VECTORS_LOAD__	;crt0's vectors, see nesbanked.cfg
+
+MMC3_SELECT	=$8000		;register number (bits 0-2), PRG/CHR modes
+MMC3_MODE	=$80		;PRG mode 0, CHR 1 KB banks at $0000-$0fff
+MMC3_DATA	=$8001
+MMC3_MIRROR	=$a000		;1 = horizontal
+MMC3_IRQ_OFF	=$e000
+
+REG_CHR_0800	=4		;1 KB at $0800: tiles $80-$bf
+REG_PRG_8000	=6
+REG_PRG_A000	=7
+BANK_CODE0	=0		;first code bank
+BANK_DATA0	=3		;first data bank
+CHR_ANIM0	=4		;1 KB CHR bank of the first animation frame
+CHR_ANIM_SHIFT	=3		;8 video frames per animation frame (4 of them)
+
+.segment "BSS"
+
+_bank_8000:	.res 1
+_bank_a000:	.res 1
+anim_timer:	.res 1
+
+.segment "RODATA"
+
+;1 KB CHR banks for R0..R5: 2 KB at $1000/$1800 (unused, both pattern
+;tables are at $0000), 1 KB at $0000-$0c00: chr_generic.s in order
+chr_regs:	.byte 0,2,0,1,2,3
+
+;power-on: only $E000-$FFFF is known until $8000 is written, so
+;select PRG mode 0 (bit 6 clear) and the first banks before crt0
+;runs anything at $C000-$DFFF; the NMI and IRQ go through crt0's
+;vectors (+5 cycles)
+
+.segment "RESET"
+
+reset:
+	sei
+	sta MMC3_IRQ_OFF
+	lda #MMC3_MODE|REG_PRG_8000
+	sta MMC3_SELECT
+	lda #BANK_CODE0
+	sta MMC3_DATA
+	lda #MMC3_MODE|REG_PRG_A000
+	sta MMC3_SELECT
+	lda #BANK_DATA0
+	sta MMC3_DATA
+	jmp (__VECTORS_LOAD__+2)
+nmi:
+	jmp (__VECTORS_LOAD__+0)
+irq:
+	jmp (__VECTORS_LOAD__+4)
+
+.segment "MMC3VECTORS"
+
+	.word nmi,reset,irq
+
+.segment "CODE"
+
+;void mapper_init(void);
+;the PRG banks are already set by reset
+
+_mapper_init:
+	lda #1
+	sta MMC3_MIRROR		;vertical scrolling
+	sta MMC3_IRQ_OFF
+	lda #BANK_CODE0
+	sta _bank_8000
+	lda #BANK_DATA0
+	sta _bank_a000
+	ldx #0
+@chr:
+	txa
+	ora #MMC3_MODE
+	sta MMC3_SELECT		;register x
+	lda chr_regs,x
+	sta MMC3_DATA
+	inx
+	cpx #6
+	bne @chr
+	rts
+
+;byte __fastcall__ bank_push(byte b);
+
+_bank_push:
+	tay
+	lda _bank_8000		;returned
+	pha
+	tya
+	jsr _bank_pop
+	pla
+	ldx #0
+	rts
+
+;void __fastcall__ bank_pop(byte b);
+
+_bank_pop:
+	sta _bank_8000
+	ldx #MMC3_MODE|REG_PRG_8000
+	stx MMC3_SELECT
+	sta MMC3_DATA
+	rts
+
+;void __fastcall__ bank_data(byte b);
+
+_bank_data:
+	sta _bank_a000
+	ldx #MMC3_MODE|REG_PRG_A000
+	stx MMC3_SELECT
+	sta MMC3_DATA
+	rts
+
+;void chr_anim_tick(void);
+;one bank write a frame, however many animated tiles are on screen
+;~35 cycles
+
+_chr_anim_tick:
+	inc anim_timer
+	lda anim_timer
+	.repeat CHR_ANIM_SHIFT
+	lsr a
+	.endrepeat
+	and #3
+	clc
+	adc #CHR_ANIM0
+	ldx #MMC3_MODE|REG_CHR_0800
+	stx MMC3_SELECT
+	sta MMC3_DATA
+	rts
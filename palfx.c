@@ -0,0 +1,199 @@
+
+#include "neslib.h"
+#include "vrambuf.h"
+#include "palfx.h"
+
+// brightness rows, as neslib's palBrightTable: color c at level l
+// is palfx_rows[l*16 + c], each level one luma row up or down
+const byte palfx_rows[12*16] = {
+  0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,
+  0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,
+  0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,
+  0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,
+  0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0f,0x0f,0x0f,
+  0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,0x1b,0x1c,0x0f,0x0f,0x0f,
+  0x20,0x21,0x22,0x23,0x24,0x25,0x26,0x27,0x28,0x29,0x2a,0x2b,0x2c,0x2d,0x0f,0x0f,
+  0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x3a,0x3b,0x3c,0x3d,0x0f,0x0f,
+  0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+  0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+  0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+  0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+};
+
+byte palfx_base[32];
+
+static byte palfx_shown[32];	// as sent to the PPU
+static byte palfx_level[8];	// brightness of each group
+static byte palfx_target[8];	// level a fade is heading for
+static byte palfx_speed[8];	// frames per fade step
+static byte palfx_timer[8];	// frames to the next fade step
+static byte palfx_fading;	// groups with level != target
+static byte palfx_dirty;	// groups with entries to send
+
+// color cycles, a slot is free when its colors are NULL
+static const byte* cyc_colors[PALFX_CYCLES];
+static byte cyc_entry[PALFX_CYCLES];
+static byte cyc_len[PALFX_CYCLES];
+static byte cyc_pos[PALFX_CYCLES];
+static byte cyc_speed[PALFX_CYCLES];
+static byte cyc_timer[PALFX_CYCLES];
+static byte cyc_turns[PALFX_CYCLES];	// passes left, 0 = forever
+static byte cyc_saved[PALFX_CYCLES];	// base color it replaced
+static byte palfx_cycling;		// slots in use
+
+static const byte group_bit[8] = {
+  0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+};
+
+// start from pal, already uploaded, at normal brightness
+void palfx_init(const char* pal) {
+  byte i;
+  for (i=0; i<32; i++) {
+    palfx_base[i] = pal[i];
+    palfx_shown[i] = pal[i];
+  }
+  for (i=0; i<8; i++) {
+    palfx_level[i] = PALFX_NORMAL;
+    palfx_target[i] = PALFX_NORMAL;
+  }
+  for (i=0; i<PALFX_CYCLES; i++) {
+    cyc_colors[i] = NULL;
+  }
+  palfx_fading = 0;
+  palfx_dirty = 0;
+  palfx_cycling = 0;
+}
+
+// set the brightness of groups now
+void palfx_bright(byte groups, byte level) {
+  byte g;
+  for (g=0; g<8; g++) {
+    if (groups & group_bit[g]) {
+      palfx_level[g] = level;
+      palfx_target[g] = level;
+    }
+  }
+  palfx_fading &= ~groups;
+  palfx_dirty |= groups;
+}
+
+// move the brightness of groups to level, a step every frames frames
+void palfx_fade(byte groups, byte level, byte frames) {
+  byte g;
+  for (g=0; g<8; g++) {
+    if ((groups & group_bit[g]) && palfx_level[g] != level) {
+      palfx_target[g] = level;
+      palfx_speed[g] = frames;
+      palfx_timer[g] = frames;
+      palfx_fading |= group_bit[g];
+    }
+  }
+}
+
+// cycle palette entry i through len colors
+void palfx_cycle(byte slot, byte i, const byte* colors, byte len,
+                 byte frames, byte turns) {
+  palfx_cycle_stop(slot);
+  cyc_colors[slot] = colors;
+  cyc_entry[slot] = i;
+  cyc_len[slot] = len;
+  cyc_pos[slot] = 0;
+  cyc_speed[slot] = frames;
+  cyc_timer[slot] = frames;
+  cyc_turns[slot] = turns;
+  cyc_saved[slot] = palfx_base[i];
+  palfx_base[i] = colors[0];
+  palfx_dirty |= group_bit[i >> 2];
+  ++palfx_cycling;
+}
+
+// stop the cycle in slot, putting its entry back
+void palfx_cycle_stop(byte slot) {
+  byte i = cyc_entry[slot];
+  if (!cyc_colors[slot]) return;
+  cyc_colors[slot] = NULL;
+  palfx_base[i] = cyc_saved[slot];
+  palfx_dirty |= group_bit[i >> 2];
+  --palfx_cycling;
+}
+
+// step the fades of the groups that have one
+static void palfx_step_fades(void) {
+  byte g, b;
+  for (g=0; g<8; g++) {
+    b = group_bit[g];
+    if (!(palfx_fading & b) || --palfx_timer[g]) continue;
+    palfx_timer[g] = palfx_speed[g];
+    if (palfx_level[g] < palfx_target[g]) {
+      ++palfx_level[g];
+    } else {
+      --palfx_level[g];
+    }
+    if (palfx_level[g] == palfx_target[g]) {
+      palfx_fading &= ~b;
+    }
+    palfx_dirty |= b;
+  }
+}
+
+// step the color cycles
+static void palfx_step_cycles(void) {
+  byte s;
+  for (s=0; s<PALFX_CYCLES; s++) {
+    if (!cyc_colors[s] || --cyc_timer[s]) continue;
+    cyc_timer[s] = cyc_speed[s];
+    if (++cyc_pos[s] == cyc_len[s]) {
+      cyc_pos[s] = 0;
+      // the last pass puts the base color back
+      if (cyc_turns[s] && !--cyc_turns[s]) {
+        palfx_cycle_stop(s);
+        continue;
+      }
+    }
+    palfx_base[cyc_entry[s]] = cyc_colors[s][cyc_pos[s]];
+    palfx_dirty |= group_bit[cyc_entry[s] >> 2];
+  }
+}
+
+// step fades and cycles, queue the entries that changed
+void palfx_update(void) {
+  byte g, i, end, c, sent;
+  const byte* row;
+  if (palfx_fading) palfx_step_fades();
+  if (palfx_cycling) palfx_step_cycles();
+  if (!palfx_dirty) return;
+  sent = 0;
+  for (g=0; g<8; g++) {
+    if (!(palfx_dirty & group_bit[g])) continue;
+    row = &palfx_rows[palfx_level[g] << 4];
+    // entry 0 of a group is the backdrop, sent with BG 0 only
+    // ($3f10 would overwrite it)
+    i = g*4;
+    end = i+4;
+    if (g) ++i;
+    for (; i<end; i++) {
+      c = row[palfx_base[i]];
+      if (c == palfx_shown[i]) continue;
+      // out of writes or buffer: the rest go next frame
+      if (sent == PALFX_WRITES || !VRAMBUF_ROOM(1)) {
+        vrambuf_end();
+        return;
+      }
+      VRAMBUF_ADD(0x3f);
+      VRAMBUF_ADD(i);
+      VRAMBUF_ADD(c);
+      palfx_shown[i] = c;
+      ++sent;
+    }
+    palfx_dirty &= ~group_bit[g];
+  }
+  vrambuf_end();
+}
+
+// send every entry still to go, flushing a frame at a time
+void palfx_wait(void) {
+  while (palfx_dirty) {
+    palfx_update();
+    vrambuf_flush();
+  }
+}
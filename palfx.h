@@ -0,0 +1,63 @@
+#ifndef _PALFX_H
+#define _PALFX_H
+
+#include "neslib.h"
+
+// palette effects on a RAM copy of the palette: brightness per
+// palette group (like pal_bright(), but for any of the 8 groups)
+// and color cycles on single entries; palfx_update() sends only
+// the entries that changed, as single writes in the update buffer
+
+// groups, OR them together
+#define PALFX_BG(n)	(0x01 << (n))	// background palette n
+#define PALFX_SPR(n)	(0x10 << (n))	// sprite palette n
+#define PALFX_ALL	0xff
+
+// brightness levels, as pal_bright()
+#define PALFX_BLACK	0
+#define PALFX_NORMAL	4
+#define PALFX_WHITE	8
+
+#define PALFX_CYCLES	2	// color cycles running at once
+#define PALFX_WRITES	8	// most entries sent per frame
+
+// the palette as set (before effects), 32 entries
+extern byte palfx_base[32];
+
+// start from pal, already uploaded with pal_all(), at normal
+// brightness and with no cycles
+void palfx_init(const char* pal);
+
+// set the brightness of groups now
+void palfx_bright(byte groups, byte level);
+
+// move the brightness of groups to level, a step every frames frames
+void palfx_fade(byte groups, byte level, byte frames);
+
+// cycle palette entry i through len colors, a color every frames
+// frames, turns times through (0 = until stopped); then entry i
+// goes back to its base color
+void palfx_cycle(byte slot, byte i, const byte* colors, byte len,
+                 byte frames, byte turns);
+
+// stop the cycle in slot, putting its entry back
+void palfx_cycle_stop(byte slot);
+
+// step fades and cycles, queue the entries that changed
+// call once a frame, before vrambuf_flush()
+void palfx_update(void);
+
+// send every entry still to go, flushing a frame at a time
+// (up to 4 frames for the whole palette)
+void palfx_wait(void);
+
+// approximate cycles per frame (cc65):
+//   nothing running           ~25
+//   a cycle step (1 entry)    ~350, ~34 more in the NMI
+//   a fade step, per group    ~450 for its 3 entries (4 for BG 0,
+//                             with the backdrop), ~100 more in the NMI
+// a fade step of all 8 groups is spread over the frames it takes
+// to send 25 entries PALFX_WRITES at a time: ~4 frames of ~1100
+// cycles (4% of a frame) and ~270 cycles of vblank each
+
+#endif // palfx.h
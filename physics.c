@@ -0,0 +1,56 @@
+
+#include "neslib.h"
+#include "platforms.h"
+#include "actors.h"
+#include "physics.h"
+
+// move actor slot i one frame
+void jumper_step(byte i, byte joy) {
+  if (joy & PAD_LEFT) {
+    actor_x[i] -= 3;
+    actor_state[i] &= ~AS_RIGHT;
+  }
+  if (joy & PAD_RIGHT) {
+    actor_x[i] += 3;
+    actor_state[i] |= AS_RIGHT;
+  }
+  actor_y[i] += actor_vy[i] / 2;
+  if (actor_vy[i] < MAX_FALL_VEL) {
+    actor_vy[i] += 1;
+  }
+}
+
+// bounce actor slot i off the platform under its feet
+byte jumper_land(byte i) {
+  byte r = find_floor(actor_x[i], actor_y[i], actor_vy[i]);
+  if (r != NO_FLOOR) {
+    actor_vy[i] = -JUMP_VEL;
+  }
+  return r;
+}
+
+// ring row of the platform a box at (x,y) falling with vy lands on
+// the platform on screen row p has its top at p*8 (ring row p+1),
+// and the box lands if p*8 is within 16 pixels below y
+// moving platforms use the same window, see actors_floor()
+byte find_floor(byte x, byte y, sbyte vy) {
+  byte p, end, r;
+  Platform *plat;
+  // nothing to land on near the top of the screen
+  if (vy < 0 || y < 60 || y > 208) return NO_FLOOR;
+  p = (y + 7) >> 3;
+  end = (y + 16) >> 3;
+  if (end > 26) end = 26;
+  for (; p <= end; p++) {
+    r = ring_row(p + 1);
+    plat = &platforms[r];
+    if (plat->draw && x >= plat->xpos*8-8 && x < (plat->xpos+3)*8) {
+      return r;
+    }
+  }
+  r = actors_floor(x, y);
+  if (r != NO_ACTOR) {
+    return FLOOR_ACTOR | r;
+  }
+  return NO_FLOOR;
+}
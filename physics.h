@@ -0,0 +1,34 @@
+#ifndef _PHYSICS_H
+#define _PHYSICS_H
+
+#include "neslib.h"
+
+#define JUMP_VEL 12		// upward velocity after a bounce
+#define MAX_FALL_VEL 16		// terminal velocity (8 pixels/frame)
+#define NO_FLOOR 0xff		// find_floor() found nothing
+#define FLOOR_ACTOR 0x80	// find_floor() landed on actor slot r & 7
+
+// the player and the AT_JUMPER actors share these, working on
+// an actor slot (see actors.h) with the input byte as a parameter
+
+// move actor slot i one frame: PAD_LEFT/PAD_RIGHT in joy move
+// and turn it, then gravity pulls on its vertical velocity
+void jumper_step(byte i, byte joy);
+
+// bounce actor slot i off the platform under its feet
+// returns find_floor()'s result
+byte jumper_land(byte i);
+
+// ring row of the platform a 16x16 box at (x,y) falling with
+// velocity vy lands on, FLOOR_ACTOR|slot for a moving platform,
+// or NO_FLOOR
+// looks only at the (at most 3) rows its feet can touch
+byte find_floor(byte x, byte y, sbyte vy);
+
+// approximate cycles per call (cc65):
+//   jumper_step  ~200
+//   jumper_land  ~300 in the air, ~700 worst case (3 rows tested,
+//                then the moving platforms in them, see actors.h)
+// fixed by the 3-row window, not by the number of platforms
+
+#endif // physics.h
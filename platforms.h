@@ -0,0 +1,25 @@
+#ifndef _PLATFORMS_H
+#define _PLATFORMS_H
+
+#include "neslib.h"
+
+#define COLS 30		// floor width in tiles
+#define ROWS 60		// total scrollable height in tiles
+
+// one platform per ring row, indexed by ring_row()
+typedef struct Platform {
+  byte ypos;
+  byte xpos;
+  byte draw;
+  byte item;
+  byte broken;
+  byte mover;	// a moving platform (actor) enters on this row
+  byte crumble;	// frames left of its crumble animation, 0 = none
+} Platform;
+
+extern Platform platforms[ROWS];
+
+// ring row at screen position pos (0 = top of the playfield)
+byte ring_row(int pos);
+
+#endif // platforms.h
@@ -0,0 +1,34 @@
+
+#include "neslib.h"
+#include "rng.h"
+
+// mixed into the seed so the streams start apart
+static const word rng_salt[RNG_STREAMS] = {
+  0x2f1d, 0x9e37, 0x5a3c
+};
+
+// seed every stream from one number
+void rng_seed(word seed) {
+  byte i;
+  word x;
+  for (i=0; i<RNG_STREAMS; i++) {
+    x = seed ^ rng_salt[i];
+    // xorshift never leaves an all-zero state
+    if (!x) x = rng_salt[i];
+    rng_lo[i] = x;
+    rng_hi[i] = x >> 8;
+  }
+}
+
+// a number in 0..n-1 by rejection on a power-of-2 mask
+byte rng_range(byte stream, byte n) {
+  byte m = n - 1;
+  byte r;
+  m |= m >> 1;
+  m |= m >> 2;
+  m |= m >> 4;
+  do {
+    r = rng_next(stream) & m;
+  } while (r >= n);
+  return r;
+}
@@ -0,0 +1,27 @@
+#ifndef _RNG_H
+#define _RNG_H
+
+#include "neslib.h"
+
+// independent random streams, so that changing how one is used
+// (say, enemy spawning) leaves the others' sequences alone
+#define RNG_LAYOUT	0	// level segments
+#define RNG_ITEMS	1	// stars
+#define RNG_ENEMIES	2	// actor spawns and jumper input
+#define RNG_STREAMS	3	// must match rng.s
+
+// 16-bit xorshift state of each stream (rng.s)
+extern byte rng_lo[RNG_STREAMS];
+extern byte rng_hi[RNG_STREAMS];
+
+// seed every stream from one number (each gets its own sequence)
+void rng_seed(word seed);
+
+// next 8 random bits of a stream (~40 cycles, rng.s)
+byte __fastcall__ rng_next(byte stream);
+
+// a number in 0..n-1 (n = 1..255), no division: rejection on
+// the next power-of-2 mask, under 2 rng_next() calls on average
+byte rng_range(byte stream, byte n);
+
+#endif // rng.h
@@ -0,0 +1,35 @@
+;16-bit xorshift (7,9,8) random streams for rng.c
+;after John Metcalf's 6502 version: x ^= x << 7, x ^= x >> 9,
+;x ^= x << 8 in a handful of shifts, period 65535 per stream
+
+	.export _rng_next
+	.export _rng_lo,_rng_hi
+
+RNG_STREAMS	=3		;must match rng.h
+
+.segment "BSS"
+
+_rng_lo:	.res RNG_STREAMS
+_rng_hi:	.res RNG_STREAMS
+
+.segment "CODE"
+
+;byte __fastcall__ rng_next(byte stream);
+;returns the new low byte, ~40 cycles
+
+_rng_next:
+	tax
+	lda _rng_hi,x
+	lsr a
+	lda _rng_lo,x
+	ror a
+	eor _rng_hi,x
+	sta _rng_hi,x		;high byte of x ^= x << 7
+	ror a
+	eor _rng_lo,x
+	sta _rng_lo,x		;x ^= x >> 9, low byte of x ^= x << 7
+	eor _rng_hi,x
+	sta _rng_hi,x		;x ^= x << 8
+	lda _rng_lo,x
+	ldx #0
+	rts
@@ -0,0 +1,38 @@
+
+// generated from segments.txt by tools/segc.py, do not edit
+// 7 segments, 73 bytes (116 as one byte per row)
+
+#include "neslib.h"
+#include "levelgen.h"
+#include "segments.h"
+#include "mapper.h"
+
+// in the level code bank (BANK_LEVEL), see mapper.h
+#if NES_MAPPER == 4
+#pragma rodata-name ("RODATA0")
+#endif
+
+const byte seg_data[] = {
+  // stairs, tier 0
+  0x0f, 0x92, 0x0c, 0xe3, 0x38, 0xce, 0x33, 0x88, 0xe3, 0x08, 0x80,
+  // zigzag, tier 1
+  0x11, 0x95, 0x89, 0x31, 0x96, 0x99, 0x31, 0x96, 0x99, 0x30, 0x95, 0x80,
+  // cluster, tier 1
+  0x0c, 0x95, 0x4c, 0x86, 0xa8, 0x6c, 0x06, 0xa8, 0x6c, 0x04, 0x10,
+  // ladder, tier 2
+  0x0d, 0x96, 0x8a, 0x82, 0xa0, 0xa8, 0x2a, 0x0a, 0x82, 0x20,
+  // shaft, tier 2
+  0x0d, 0x96, 0x1e, 0x87, 0xa1, 0xe8, 0x62, 0x00,
+  // leaps, tier 3
+  0x14, 0x93, 0x29, 0x6a, 0x9a, 0x29, 0x6a, 0x93, 0x19, 0x60,
+  // gauntlet, tier 3
+  0x13, 0x95, 0x1b, 0x81, 0xf5, 0x1a, 0x07, 0xd8, 0x6e, 0x66, 0x5c,
+};
+
+const word seg_start[] = {
+  0, 11, 23, 34, 44, 52, 62
+};
+
+const byte seg_tier_count[LG_TIERS] = {
+  1, 3, 5, 7
+};
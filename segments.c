@@ -0,0 +1,65 @@
+
+#include "neslib.h"
+#include "levelgen.h"
+#include "segments.h"
+#include "mapper.h"
+
+// in the level code bank (BANK_LEVEL), see mapper.h
+#if NES_MAPPER == 4
+#pragma code-name ("CODE0")
+#pragma rodata-name ("RODATA0")
+#endif
+
+static const byte* seg_ptr;	// next byte of the bitstream
+static byte seg_byte;		// the byte being read
+static byte seg_mask;		// its next bit, 0 = read another
+static byte seg_rows;		// rows left in the segment
+static byte seg_empty;		// empty rows left in the current run
+static byte seg_x;		// column of the last platform
+
+// next n bits, MSB first
+static byte seg_bits(byte n) {
+  byte v = 0;
+  while (n--) {
+    if (!seg_mask) {
+      seg_byte = *seg_ptr++;
+      seg_mask = 0x80;
+    }
+    v <<= 1;
+    if (seg_byte & seg_mask) v |= 1;
+    seg_mask >>= 1;
+  }
+  return v;
+}
+
+// start reading segment n
+void seg_begin(byte n) {
+  seg_ptr = seg_data + seg_start[n];
+  seg_rows = *seg_ptr++;
+  seg_mask = 0;
+  seg_empty = 0;
+  seg_x = 0;
+}
+
+// next row up of the segment as a levelgen row byte
+byte seg_row(void) {
+  byte t;
+  if (!seg_rows) return LG_END;
+  --seg_rows;
+  // the rest of a run of empty rows
+  if (seg_empty) {
+    --seg_empty;
+    return LG_EMPTY;
+  }
+  if (!seg_bits(1)) {
+    seg_empty = seg_bits(2);
+    return LG_EMPTY;
+  }
+  t = seg_bits(2) + LG_PLAIN;
+  if (seg_bits(1)) {
+    seg_x = seg_bits(5);
+  } else {
+    seg_x += seg_bits(3) - 4;
+  }
+  return t << 5 | seg_x;
+}
@@ -0,0 +1,24 @@
+#ifndef _SEGMENTS_H
+#define _SEGMENTS_H
+
+#include "neslib.h"
+
+// authored segments (segments.txt), packed into a bitstream by
+// tools/segc.py (segdata.c), the format is described there
+
+// all segments, seg_start[n] is where segment n begins
+// segments are sorted by tier: the first seg_tier_count[t] of
+// them are playable at tier t
+extern const byte seg_data[];
+extern const word seg_start[];
+extern const byte seg_tier_count[];
+
+// start reading segment n
+void seg_begin(byte n);
+
+// next row up of the segment as a levelgen row byte
+// (type << 5 | xpos), LG_END after the last one
+// reads at most 9 bits, ~400 cycles worst case
+byte seg_row(void);
+
+#endif // segments.h
@@ -0,0 +1,80 @@
+
+#include "neslib.h"
+#include "sprites.h"
+#include "actors.h"
+#include "shots.h"
+
+byte shot_x[MAX_SHOTS];
+byte shot_y[MAX_SHOTS];
+
+// oldest shot and number of shots in the ring
+static byte shot_tail;
+static byte shot_count;
+
+// empty the ring
+void shots_clear(void) {
+  shot_tail = 0;
+  shot_count = 0;
+}
+
+// fire a shot, ignored when the ring is full or y is off screen
+void shot_fire(byte x, byte y) {
+  byte i;
+  if (shot_count == MAX_SHOTS || y >= SHOT_MAX_Y) return;
+  i = (shot_tail + shot_count) & (MAX_SHOTS-1);
+  shot_x[i] = x;
+  shot_y[i] = y;
+  ++shot_count;
+}
+
+// move every shot up and test it against the actors in its row
+byte shots_update(void) {
+  byte i, j, n;
+  byte hits = 0;
+  i = shot_tail;
+  for (n = shot_count; n; --n, i = (i + 1) & (MAX_SHOTS-1)) {
+    if (shot_y[i] == SHOT_DEAD) continue;
+    if (shot_y[i] < SHOT_SPEED) {
+      shot_y[i] = SHOT_DEAD;
+      continue;
+    }
+    shot_y[i] -= SHOT_SPEED;
+    // test the dot inside the sprite
+    j = actors_at(shot_x[i] + 4, shot_y[i] + 6);
+    if (j != NO_ACTOR) {
+      actor_despawn(j);
+      shot_y[i] = SHOT_DEAD;
+      ++hits;
+    }
+  }
+  // spent shots leave from the tail, in firing order
+  while (shot_count && shot_y[shot_tail] == SHOT_DEAD) {
+    shot_tail = (shot_tail + 1) & (MAX_SHOTS-1);
+    --shot_count;
+  }
+  return hits;
+}
+
+// one sprite per shot
+void shots_draw(void) {
+  byte i, n;
+  i = shot_tail;
+  for (n = shot_count; n; --n, i = (i + 1) & (MAX_SHOTS-1)) {
+    if (shot_y[i] != SHOT_DEAD) {
+      spr_put(shot_x[i], shot_y[i], CH_SHOT, SHOT_PAL);
+    }
+  }
+}
+
+// move shots down one row after a scroll step
+void shots_scroll(void) {
+  byte i;
+  for (i=0; i<MAX_SHOTS; i++) {
+    // compare against the screen, not SHOT_DEAD: y 247 + 8 is 0xff
+    if (shot_y[i] < SHOT_MAX_Y-8) {
+      shot_y[i] += 8;
+    } else {
+      shot_y[i] = SHOT_DEAD;
+    }
+  }
+}
@@ -0,0 +1,42 @@
+#ifndef _SHOTS_H
+#define _SHOTS_H
+
+#include "neslib.h"
+
+#define MAX_SHOTS 4		// ring capacity (power of 2)
+#define SHOT_SPEED 6		// pixels per frame, upward
+#define SHOT_DEAD 0xff		// shot_y of a spent shot
+#define SHOT_MAX_Y 240		// live shots are on screen, y below this
+#define CH_SHOT '.'		// sprite tile, the dot is at (3,5)..(5,7)
+#define SHOT_PAL 3		// sprite palette
+
+// shots in flight, oldest first from the ring tail
+// all move at the same speed, so the oldest is always the highest
+extern byte shot_x[MAX_SHOTS];
+extern byte shot_y[MAX_SHOTS];
+
+// empty the ring
+void shots_clear(void);
+
+// fire a shot with its sprite at (x,y), ignored when the ring is full
+// or y is off screen (fired from near the top, y - 8 wraps)
+void shot_fire(byte x, byte y);
+
+// move every shot up, retire those off the top, and despawn the
+// actors they hit; returns the number of actors hit
+byte shots_update(void);
+
+// one sprite per shot
+void shots_draw(void);
+
+// move shots down one row after a scroll step, retiring any that
+// leave the screen
+void shots_scroll(void);
+
+// hit tests only look at the actors in the shot's row (actors_at)
+// approximate cycles per frame (cc65), full ring and actor pool:
+//   per shot     ~60 move, ~140 empty row, up to ~500 with 8 candidates
+//   draw         ~150 per shot
+// worst case about 2900 cycles (10% of a frame), ~1400 typical
+
+#endif // shots.h
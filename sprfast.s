@@ -0,0 +1,137 @@
+;unrolled metasprite writers for the rotating OAM slots in sprites.c
+;a 2x2 (or any 4-entry) metasprite is copied without the per-entry
+;terminator check and pointer bumps of oam_meta_spr()/spr_meta(),
+;H-flipped shapes already have their entries in flipped order
+;(see DEF_METASPRITE_2x2_FLIP), so no flag is tested here
+
+;approximate cycles per 4-entry metasprite:
+; spr_meta (C, one spr_put per entry)	~600
+; oam_meta_spr (neslib)			~370
+; spr_meta4				~300
+;falls back to one slot at a time when the shape would wrap the ring
+
+	.export _spr_meta4,_spr_meta2
+	.import _spr_next,_spr_count
+	.import popa
+	.importzp ptr1,tmp1,tmp2,tmp3
+
+OAM_BUF		=$0200
+SPR_SLOTS	=63		;must match sprites.h
+
+.segment "CODE"
+
+;copy entry I from (ptr1) to the slot at x, y = I*4 on entry
+.macro copy_entry I
+	lda (ptr1),y		;x offset
+	clc
+	adc tmp1
+	sta OAM_BUF+4+3+I*4,x
+	iny
+	lda (ptr1),y		;y offset
+	clc
+	adc tmp2
+	sta OAM_BUF+4+0+I*4,x
+	iny
+	lda (ptr1),y		;tile
+	sta OAM_BUF+4+1+I*4,x
+	iny
+	lda (ptr1),y		;attribute
+	sta OAM_BUF+4+2+I*4,x
+	iny
+.endmacro
+
+;common entry: ptr1 = data, tmp1 = x, tmp2 = y, tmp3 = entries
+;returns carry set if the fast path can't be used
+args:
+	sta ptr1
+	stx ptr1+1
+	jsr popa
+	sta tmp2
+	jsr popa
+	sta tmp1
+	lda _spr_count		;room for all entries?
+	clc
+	adc tmp3
+	cmp #SPR_SLOTS+1
+	bcs @slow
+	lda _spr_next		;no wrap inside the shape?
+	clc
+	adc tmp3
+	cmp #SPR_SLOTS+1
+@slow:
+	rts
+
+;bump spr_next and spr_count by tmp3 after a fast copy
+advance:
+	lda _spr_count
+	clc
+	adc tmp3
+	sta _spr_count
+	lda _spr_next
+	clc
+	adc tmp3
+	cmp #SPR_SLOTS
+	bne @1
+	lda #0
+@1:
+	sta _spr_next
+	rts
+
+;void __fastcall__ spr_meta4(byte x, byte y, const unsigned char* data);
+
+_spr_meta4:
+	ldy #4
+	sty tmp3
+	jsr args
+	bcs slow
+	lda _spr_next
+	asl a
+	asl a
+	tax
+	ldy #0
+	copy_entry 0
+	copy_entry 1
+	copy_entry 2
+	copy_entry 3
+	jmp advance
+
+;void __fastcall__ spr_meta2(byte x, byte y, const unsigned char* data);
+
+_spr_meta2:
+	ldy #2
+	sty tmp3
+	jsr args
+	bcs slow
+	lda _spr_next
+	asl a
+	asl a
+	tax
+	ldy #0
+	copy_entry 0
+	copy_entry 1
+	jmp advance
+
+;one slot at a time, wrapping the ring and stopping when full
+slow:
+	ldy #0
+@loop:
+	lda _spr_count
+	cmp #SPR_SLOTS
+	beq @done
+	lda _spr_next
+	asl a
+	asl a
+	tax
+	copy_entry 0
+	inc _spr_count
+	inc _spr_next
+	lda _spr_next
+	cmp #SPR_SLOTS
+	bne @1
+	lda #0
+	sta _spr_next
+@1:
+	dec tmp3
+	bne @loop
+@done:
+	rts
@@ -0,0 +1,98 @@
+
+#include "neslib.h"
+#include "sprites.h"
+
+// first slot this frame, relative to slot 1
+static byte spr_start;
+// next slot to fill, relative to slot 1
+byte spr_next;
+// slots used last frame
+static byte spr_prev;
+
+// slots used so far this frame
+byte spr_count;
+
+// reset the allocator and hide every sprite
+void spr_clear(void) {
+  oam_clear();
+  spr_start = 0;
+  spr_count = 0;
+}
+
+// start a frame: move the first slot by SPR_STEP
+void spr_begin(void) {
+  spr_prev = spr_count;
+  spr_count = 0;
+  spr_start += SPR_STEP;
+  if (spr_start >= SPR_SLOTS) spr_start -= SPR_SLOTS;
+  spr_next = spr_start;
+}
+
+// put one sprite in the next rotating slot (dropped when full)
+void spr_put(byte x, byte y, byte tile, byte attr) {
+  register OAMSprite* o;
+  if (spr_count == SPR_SLOTS) return;
+  o = &OAMBUF[spr_next+1];
+  o->x = x;
+  o->y = y;
+  o->name = tile;
+  o->attr = attr;
+  ++spr_count;
+  if (++spr_next == SPR_SLOTS) spr_next = 0;
+}
+
+// put a 128-terminated metasprite, one slot per entry
+void spr_meta(byte x, byte y, const unsigned char* data) {
+  while (data[0] != 128) {
+    spr_put(x+data[0], y+data[1], data[2], data[3]);
+    data += 4;
+  }
+}
+
+// hide slots from..to-1, counted from this frame's first slot
+static void hide_range(byte from, byte to) {
+  byte slot = spr_start + from;
+  if (slot >= SPR_SLOTS) slot -= SPR_SLOTS;
+  for (; from < to; ++from) {
+    OAMBUF[slot+1].y = 240;
+    if (++slot == SPR_SLOTS) slot = 0;
+  }
+}
+
+// end a frame: hide only the slots used last frame and not this one
+// last frame's slots start SPR_STEP before this frame's first slot
+void spr_end(void) {
+  byte lo, hi;
+  // the part of last frame's range before this frame's start
+  lo = MAX(spr_count, SPR_SLOTS - SPR_STEP);
+  hi = (spr_prev < SPR_STEP) ? SPR_SLOTS - SPR_STEP + spr_prev : SPR_SLOTS;
+  if (lo < hi) hide_range(lo, hi);
+  // the part past this frame's end
+  if (spr_prev > SPR_STEP + spr_count) {
+    hide_range(spr_count, spr_prev - SPR_STEP);
+  }
+}
+
+#ifdef SPR_BENCH
+// count 2x2 metasprites written in one frame by each writer
+// 0 = spr_meta4, 1 = spr_meta, 2 = oam_meta_spr
+word spr_bench(byte writer, const unsigned char* data) {
+  word n = 0;
+  byte clock;
+  ppu_wait_nmi();
+  clock = nesclock();
+  while (nesclock() == clock) {
+    // keep writing the same slots so the ring never fills
+    spr_next = 0;
+    spr_count = 0;
+    switch (writer) {
+      case 0: spr_meta4(n, 100, data); break;
+      case 1: spr_meta(n, 100, data); break;
+      case 2: oam_meta_spr(n, 100, 4, data); break;
+    }
+    ++n;
+  }
+  spr_clear();
+  return n;
+}
+#endif
@@ -0,0 +1,108 @@
+
+#ifndef _SPRITES_H
+#define _SPRITES_H
+
+#include "neslib.h"
+
+#define DEF_METASPRITE_2x2(name,code,pal)\
+const unsigned char name[]={\
+        0,      0,      (code)+0,   pal, \
+        0,      8,      (code)+1,   pal, \
+        8,      0,      (code)+2,   pal, \
+        8,      8,      (code)+3,   pal, \
+        128};
+
+#define DEF_METASPRITE_2x2_FLIP(name,code,pal)\
+const unsigned char name[]={\
+        8,      0,      (code)+0,   (pal)|OAM_FLIP_H, \
+        8,      8,      (code)+1,   (pal)|OAM_FLIP_H, \
+        0,      0,      (code)+2,   (pal)|OAM_FLIP_H, \
+        0,      8,      (code)+3,   (pal)|OAM_FLIP_H, \
+        128};
+
+// 2x2 with the top row moved down by top pixels (negative = up)
+// squashes or stretches the sprite without extra tiles
+#define DEF_METASPRITE_2x2_TOP(name,code,pal,top)\
+const unsigned char name[]={\
+        0,      (top),  (code)+0,   pal, \
+        0,      8,      (code)+1,   pal, \
+        8,      (top),  (code)+2,   pal, \
+        8,      8,      (code)+3,   pal, \
+        128};
+
+#define DEF_METASPRITE_2x2_TOP_FLIP(name,code,pal,top)\
+const unsigned char name[]={\
+        8,      (top),  (code)+0,   (pal)|OAM_FLIP_H, \
+        8,      8,      (code)+1,   (pal)|OAM_FLIP_H, \
+        0,      (top),  (code)+2,   (pal)|OAM_FLIP_H, \
+        0,      8,      (code)+3,   (pal)|OAM_FLIP_H, \
+        128};
+
+// 2x2 upside down
+#define DEF_METASPRITE_2x2_VFLIP(name,code,pal)\
+const unsigned char name[]={\
+        0,      8,      (code)+0,   (pal)|OAM_FLIP_V, \
+        0,      0,      (code)+1,   (pal)|OAM_FLIP_V, \
+        8,      8,      (code)+2,   (pal)|OAM_FLIP_V, \
+        8,      0,      (code)+3,   (pal)|OAM_FLIP_V, \
+        128};
+
+// 2x1, two tiles side by side
+#define DEF_METASPRITE_2x1(name,code,pal)\
+const unsigned char name[]={\
+        0,      0,      (code)+0,   pal, \
+        8,      0,      (code)+1,   pal, \
+        128};
+
+#define DEF_METASPRITE_2x1_FLIP(name,code,pal)\
+const unsigned char name[]={\
+        8,      0,      (code)+0,   (pal)|OAM_FLIP_H, \
+        0,      0,      (code)+1,   (pal)|OAM_FLIP_H, \
+        128};
+
+// 4x1 strip: left cap, two middle tiles, right cap
+#define DEF_METASPRITE_4x1(name,left,mid,right,pal)\
+const unsigned char name[]={\
+        0,      0,      left,   pal, \
+        8,      0,      mid,    pal, \
+        16,     0,      mid,    pal, \
+        24,     0,      right,  pal, \
+        128};
+
+// OAM slot 0 is kept for sprite 0, the other 63 slots rotate
+#define SPR_SLOTS	63	// rotating slots (OAM offsets 4..255)
+#define SPR_STEP	17	// slots the start moves each frame
+
+// slots used so far this frame
+extern byte spr_count;
+// next slot to fill, relative to slot 1 (also used by sprfast.s)
+extern byte spr_next;
+
+// reset the allocator and hide every sprite
+void spr_clear(void);
+
+// start a frame: move the first slot by SPR_STEP
+void spr_begin(void);
+
+// put one sprite in the next rotating slot (dropped when full)
+void spr_put(byte x, byte y, byte tile, byte attr);
+
+// put a 128-terminated metasprite, one slot per entry
+void spr_meta(byte x, byte y, const unsigned char* data);
+
+// put a 4-entry metasprite (2x2 or 4x1) with an unrolled writer
+void __fastcall__ spr_meta4(byte x, byte y, const unsigned char* data);
+
+// put a 2-entry metasprite (2x1) with an unrolled writer
+void __fastcall__ spr_meta2(byte x, byte y, const unsigned char* data);
+
+// end a frame: hide only the slots used last frame and not this one
+void spr_end(void);
+
+#ifdef SPR_BENCH
+// count 2x2 metasprites written in one frame by each writer
+// 0 = spr_meta4, 1 = spr_meta, 2 = oam_meta_spr
+word spr_bench(byte writer, const unsigned char* data);
+#endif
+
+#endif // sprites.h
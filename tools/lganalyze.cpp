@@ -0,0 +1,298 @@
+// lganalyze: level generator statistics on the host
+//
+// builds levelgen.c, difficulty.c and rng.c unmodified (through
+// lgshim.h, with rng.s redone in C) and runs many seeds at once,
+// one generator copy per thread, the way the game calls it:
+// levelgen_start() on the start platform, then levelgen_row()
+// and difficulty_row() once per row climbed
+//
+//   g++ -O2 -std=c++17 -pthread -o lganalyze tools/lganalyze.cpp
+//   ./lganalyze [-s seeds] [-r rows] [-t threads] [-f csv|json] [-o file]
+//
+// seeds are 1..seeds, at most 65535 (rng_seed() takes a word);
+// threads default to the core count; -t takes at most LGA_COPIES,
+// -DLGA_COPIES=n raises (to ~190, the compiler's include depth)
+//
+// reports, for each difficulty level and for all of them:
+//   gap       empty rows between two platforms
+//   broken    runs of broken platforms in a row
+//   items     stars per LGA_WINDOW rows
+//   unreach   platforms out of reach of the one below, by rows up
+//             (checked against the jump physics here, not lg_reach)
+//   est_cycles  6502 cycles per row, in LGA_CYCLE_BUCKET steps, from
+//             the model below (estimated, not measured)
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+// generator copies compiled in, one per thread
+#ifndef LGA_COPIES
+#define LGA_COPIES	64
+#endif
+
+#include "lgshim.h"
+#include "../platforms.h"
+#include "../physics.h"
+
+#define LGA_CAT2(a, b) a##b
+#define LGA_CAT(a, b) LGA_CAT2(a, b)
+
+// entry points of one generator copy
+struct LgCopy {
+  void (*seed)(word);
+  void (*diff_reset)(void);
+  void (*diff_row)(void);
+  void (*start)(byte);
+  void (*row)(Platform*);
+  const byte* level;
+  unsigned long* rng_calls;
+};
+
+static std::vector<LgCopy>& lga_copies() {
+  static std::vector<LgCopy> copies;
+  return copies;
+}
+
+static int lga_register(const LgCopy& c) {
+  lga_copies().push_back(c);
+  return 0;
+}
+
+// LGA_COPIES copies, lgcopy.h includes itself for the rest
+#include "lgcopy.h"
+static_assert(__COUNTER__ == 2*LGA_COPIES, "lgcopy.h copy count");
+
+#define LGA_WINDOW	32	// rows per item count
+#define LGA_BINS	33	// histogram bins, the last one holds the rest
+#define LGA_MAX_UP	8	// rows up checked for reach
+#define LGA_XSPEED	3	// pixels a frame sideways (jumper_step)
+#define LGA_START_X	14	// start platform column (create_platforms)
+
+// estimated cycles of one row (cc65), after levelgen.h: the row
+// itself and the curves, then each rng_next() with its call
+#define LGA_ROW_CYCLES	180
+#define LGA_RNG_CYCLES	60
+#define LGA_CYCLE_BUCKET 20
+#define LGA_MAX_SEEDS	65535	// distinct rng_seed() values
+
+enum { M_GAP, M_BROKEN, M_ITEMS, M_UNREACH, M_CYCLES, M_COUNT };
+static const char* const metric_name[M_COUNT] = {
+  "gap", "broken", "items", "unreach", "est_cycles"
+};
+
+struct Hist {
+  unsigned long long n[DIFF_LEVELS][M_COUNT][LGA_BINS];
+  unsigned long long rows;
+
+  void add(int level, int m, int v) {
+    if (v >= LGA_BINS) v = LGA_BINS-1;
+    ++n[level][m][v];
+  }
+  void merge(const Hist& h) {
+    for (int l = 0; l < DIFF_LEVELS; l++)
+      for (int m = 0; m < M_COUNT; m++)
+        for (int b = 0; b < LGA_BINS; b++)
+          n[l][m][b] += h.n[l][m][b];
+    rows += h.rows;
+  }
+};
+
+// tiles sideways a bounce reaches k rows up (0: out of reach),
+// stepping the jump the way jumper_step()/find_floor() do, from
+// the worst place on the lower platform: the frames until it can
+// land, at LGA_XSPEED, plus the whole 32-pixel landing width
+static int reach[LGA_MAX_UP+1];
+
+static void make_reach() {
+  for (int k = 1; k <= LGA_MAX_UP; k++) {
+    int worst = -1;
+    for (int pa = 10; pa <= 26; pa++) {
+      for (int y0 = 0; y0 < 256; y0++) {
+        if (pa < (y0+7) >> 3 || pa > std::min((y0+16) >> 3, 26)) continue;
+        int y = y0, vy = -JUMP_VEL, t = -1;
+        for (int f = 1; f < 100; f++) {
+          y += vy / 2;
+          if (vy < MAX_FALL_VEL) vy++;
+          if (vy < 0) continue;
+          int pb = pa - k;
+          if ((y+7) >> 3 > pb) break;
+          if ((y+16) >> 3 >= pb) { t = f; break; }
+        }
+        if (t < 0) { worst = -1; goto done; }
+        if (worst < 0 || t < worst) worst = t;
+      }
+    }
+  done:
+    reach[k] = worst < 0 ? 0 : (worst * LGA_XSPEED + 31) / 8;
+  }
+}
+
+// one seed: rows climbed from the start platform
+static void run_seed(const LgCopy& g, word seed, long rows, Hist& h) {
+  Platform p;
+  int gap = 0, run = 0, items = 0, anchor = LGA_START_X;
+  g.seed(seed);
+  g.diff_reset();
+  g.start(LGA_START_X);
+  for (long i = 0; i < rows; i++) {
+    int level = *g.level;
+    unsigned long calls = *g.rng_calls;
+    memset(&p, 0, sizeof(p));
+    g.row(&p);
+    calls = *g.rng_calls - calls;
+    h.add(level, M_CYCLES,
+          (LGA_ROW_CYCLES + LGA_RNG_CYCLES * calls) / LGA_CYCLE_BUCKET);
+    if (p.draw || p.mover) {
+      int up = gap + 1;
+      if (up > LGA_MAX_UP || !reach[up] ||
+          std::abs(p.xpos - anchor) > reach[up]) {
+        h.add(level, M_UNREACH, std::min(up, LGA_MAX_UP));
+      }
+      h.add(level, M_GAP, gap);
+      if (p.broken) {
+        ++run;
+      } else if (run) {
+        h.add(level, M_BROKEN, run);
+        run = 0;
+      }
+      anchor = p.xpos;
+      gap = 0;
+    } else {
+      ++gap;
+    }
+    items += p.item;
+    if ((i + 1) % LGA_WINDOW == 0) {
+      h.add(level, M_ITEMS, items);
+      items = 0;
+    }
+    g.diff_row();
+  }
+  h.rows += rows;
+}
+
+static void write_csv(FILE* f, const Hist& h) {
+  fprintf(f, "metric,level,value,count\n");
+  for (int m = 0; m < M_COUNT; m++) {
+    for (int b = 0; b < LGA_BINS; b++) {
+      unsigned long long all = 0;
+      for (int l = 0; l < DIFF_LEVELS; l++) {
+        all += h.n[l][m][b];
+        if (h.n[l][m][b])
+          fprintf(f, "%s,%d,%d,%llu\n", metric_name[m], l, b, h.n[l][m][b]);
+      }
+      if (all)
+        fprintf(f, "%s,all,%d,%llu\n", metric_name[m], b, all);
+    }
+  }
+}
+
+static void write_bins(FILE* f, const unsigned long long* n) {
+  fprintf(f, "[");
+  for (int b = 0; b < LGA_BINS; b++)
+    fprintf(f, "%s%llu", b ? "," : "", n[b]);
+  fprintf(f, "]");
+}
+
+static void write_json(FILE* f, const Hist& h, long seeds, long rows) {
+  fprintf(f, "{\n  \"seeds\": %ld,\n  \"rows_per_seed\": %ld,\n", seeds, rows);
+  fprintf(f, "  \"rows\": %llu,\n  \"window\": %d,\n", h.rows, LGA_WINDOW);
+  fprintf(f, "  \"cycle_bucket\": %d,\n", LGA_CYCLE_BUCKET);
+  fprintf(f, "  \"est_cycles_model\": \"estimated, %d + %d per rng_next()\",\n",
+          LGA_ROW_CYCLES, LGA_RNG_CYCLES);
+  fprintf(f, "  \"reach\": [");
+  for (int k = 1; k <= LGA_MAX_UP; k++)
+    fprintf(f, "%s%d", k > 1 ? "," : "", reach[k]);
+  fprintf(f, "],\n");
+  for (int m = 0; m < M_COUNT; m++) {
+    unsigned long long all[LGA_BINS] = {0};
+    for (int l = 0; l < DIFF_LEVELS; l++)
+      for (int b = 0; b < LGA_BINS; b++)
+        all[b] += h.n[l][m][b];
+    fprintf(f, "  \"%s\": {\n    \"all\": ", metric_name[m]);
+    write_bins(f, all);
+    fprintf(f, ",\n    \"levels\": [\n");
+    for (int l = 0; l < DIFF_LEVELS; l++) {
+      fprintf(f, "      ");
+      write_bins(f, h.n[l][m]);
+      fprintf(f, "%s\n", l < DIFF_LEVELS-1 ? "," : "");
+    }
+    fprintf(f, "    ]\n  }%s\n", m < M_COUNT-1 ? "," : "");
+  }
+  fprintf(f, "}\n");
+}
+
+static void usage() {
+  fprintf(stderr, "usage: lganalyze [-s seeds] [-r rows] [-t threads]"
+                  " [-f csv|json] [-o file]\n");
+  exit(1);
+}
+
+int main(int argc, char** argv) {
+  long seeds = 1024, rows = 100000;
+  unsigned threads = 0;		// 0: one per core
+  std::string format = "csv", out;
+  for (int i = 1; i < argc; i++) {
+    if (i + 1 >= argc || argv[i][0] != '-') usage();
+    const char* v = argv[++i];
+    switch (argv[i-1][1]) {
+      case 's': seeds = atol(v); break;
+      case 'r': rows = atol(v); break;
+      case 't': threads = atoi(v); break;
+      case 'f': format = v; break;
+      case 'o': out = v; break;
+      default: usage();
+    }
+  }
+  if (format != "csv" && format != "json") usage();
+  if (seeds < 1 || seeds > LGA_MAX_SEEDS) {
+    fprintf(stderr, "lganalyze: seeds are 1..%d\n", LGA_MAX_SEEDS);
+    return 1;
+  }
+  if (!threads) {
+    threads = std::min<unsigned>(std::thread::hardware_concurrency(),
+                                 lga_copies().size());
+  } else if (threads > lga_copies().size()) {
+    fprintf(stderr, "lganalyze: at most %zu threads,"
+                    " build with -DLGA_COPIES=n for more\n",
+            lga_copies().size());
+    return 1;
+  }
+  threads = std::max(1u, threads);
+  make_reach();
+
+  // seeds 1..seeds, handed out one at a time
+  std::atomic<long> next(0);
+  std::vector<Hist> hist(threads);
+  std::vector<std::thread> pool;
+  for (unsigned t = 0; t < threads; t++) {
+    pool.emplace_back([&, t] {
+      long s;
+      while ((s = next++) < seeds) {
+        run_seed(lga_copies()[t], (word)(s + 1), rows, hist[t]);
+      }
+    });
+  }
+  for (auto& th : pool) th.join();
+  for (unsigned t = 1; t < threads; t++) hist[0].merge(hist[t]);
+
+  FILE* f = out.empty() ? stdout : fopen(out.c_str(), "w");
+  if (!f) {
+    perror(out.c_str());
+    return 1;
+  }
+  if (format == "csv") {
+    write_csv(f, hist[0]);
+  } else {
+    write_json(f, hist[0], seeds, rows);
+  }
+  if (f != stdout) fclose(f);
+  fprintf(stderr, "%llu rows, %ld seeds, %u threads\n",
+          hist[0].rows, seeds, threads);
+  return 0;
+}
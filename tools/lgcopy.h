@@ -0,0 +1,44 @@
+// one private copy of the level generator's state and code,
+// in a namespace of its own so each worker thread gets one
+// (no include guard: it includes itself again until there are
+// LGA_COPIES copies, each one using __COUNTER__ twice)
+
+namespace LGA_CAT(lgcopy, __COUNTER__) {
+
+#undef _LEVELGEN_H
+#undef _DIFFICULTY_H
+#undef _RNG_H
+#undef _SEGMENTS_H
+
+#include "../levelgen.c"
+#include "../difficulty.c"
+#include "../rng.c"
+#include "../segments.c"
+#include "../segdata.c"
+
+// rng.s in C: xorshift (7,9,8) on each 16-bit stream
+byte rng_lo[RNG_STREAMS];
+byte rng_hi[RNG_STREAMS];
+unsigned long rng_calls;
+
+byte rng_next(byte stream) {
+  word x = rng_lo[stream] | rng_hi[stream] << 8;
+  x ^= x << 7;
+  x ^= x >> 9;
+  x ^= x << 8;
+  rng_lo[stream] = x;
+  rng_hi[stream] = x >> 8;
+  ++rng_calls;
+  return x;
+}
+
+static const int registered = lga_register(LgCopy {
+  rng_seed, difficulty_reset, difficulty_row,
+  levelgen_start, levelgen_row, &diff_level, &rng_calls
+});
+
+}
+
+#if __COUNTER__ < 2*LGA_COPIES - 1
+#include "lgcopy.h"
+#endif
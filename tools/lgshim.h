@@ -0,0 +1,21 @@
+// host stand-ins for the parts of the NES build the level
+// generator touches, so levelgen.c, difficulty.c and rng.c
+// compile unmodified as C++ (see lganalyze.cpp)
+
+#ifndef LGSHIM_H
+#define LGSHIM_H
+
+// neslib.h declares bool as an enum, which C++ can't take;
+// its guard is set here so the sources skip it
+#define _NESLIB_H
+
+typedef unsigned char byte;
+typedef signed char sbyte;
+typedef unsigned short word;
+
+#define __fastcall__
+
+// no banks on the host (mapper.h)
+#define NES_MAPPER 0
+
+#endif // LGSHIM_H
@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+# segc: compile segments.txt into segdata.c
+#
+#   python3 tools/segc.py segments.txt segdata.c
+#
+# the bitstream of one segment (see segments.h), bits MSB first:
+#   a byte with the number of rows, then for each run of rows
+#   from the bottom up:
+#     0 nn          1+nn empty rows (nn = 0..3)
+#     1 tt 0 ddd    a platform of type tt+1 (LG_PLAIN..LG_MOVER)
+#                   at the last platform's column + ddd-4
+#     1 tt 1 xxxxx  the same at column xxxxx
+# segments are padded to whole bytes and listed by tier
+
+import re
+import sys
+
+LG_PLAIN, LG_BROKEN, LG_ITEM, LG_MOVER = 1, 2, 3, 4
+LG_TIERS = 4
+COLS = 30
+MIN_X, MAX_X = 3, 25
+
+SHAPES = {"====": LG_PLAIN, "~~~~": LG_BROKEN, "<==>": LG_MOVER}
+
+
+def fail(where, msg):
+    sys.exit("%s: %s" % (where, msg))
+
+
+# limits the game checks at run time, read from its sources so
+# the two can't drift apart
+def read_limits(root):
+    src = open(root + "levelgen.c").read()
+    m = re.search(r"lg_reach\[[^]]*\] = \{([^}]*)\}", src)
+    reach = [int(v) for v in m.group(1).split(",")]
+    src = open(root + "difficulty.c").read()
+    tables = {}
+    for name, body in re.findall(r"const byte (diff_\w+)\[DIFF_LEVELS\] = \{([^}]*)\}", src):
+        tables[name] = [int(v) for v in body.split(",")]
+    # the smallest gap any level of a tier allows
+    gaps = [None] * LG_TIERS
+    for tier, gap in zip(tables["diff_tier"], tables["diff_gap"]):
+        if gaps[tier] is None or gap < gaps[tier]:
+            gaps[tier] = gap
+    return reach, gaps
+
+
+# segments as (name, tier, rows), rows bottom first as (type, x)
+# or None for an empty row
+def parse(path):
+    segs = []
+    cur = None
+    for n, line in enumerate(open(path), 1):
+        where = "%s:%d" % (path, n)
+        line = line.rstrip("\n")
+        if not line.strip() or line.startswith(";"):
+            continue
+        words = line.split()
+        if words[0] == "segment":
+            if cur or len(words) != 3:
+                fail(where, "bad segment line")
+            cur = (words[1], int(words[2]), [], where)
+        elif words[0] == "end":
+            if not cur:
+                fail(where, "end without segment")
+            segs.append(cur)
+            cur = None
+        elif line.startswith("|"):
+            if not cur:
+                fail(where, "row outside a segment")
+            if len(line) != COLS + 2 or not line.endswith("|"):
+                fail(where, "rows are %d columns between bars" % COLS)
+            cur[2].append((line[1:-1], where))
+        else:
+            fail(where, "can't read this line")
+    if cur:
+        fail(cur[3], "segment without end")
+
+    out = []
+    for name, tier, lines, where in segs:
+        if not 0 <= tier < LG_TIERS:
+            fail(where, "tier out of range")
+        rows = []
+        for text, lw in reversed(lines):
+            row = None
+            body = text.replace(".", " ")
+            for shape, kind in SHAPES.items():
+                x = body.find(shape)
+                if x >= 0:
+                    body = body[:x] + "    " + body[x+4:]
+                    row = [kind, x]
+                    break
+            if "*" in body:
+                x = body.find("*")
+                body = body[:x] + " " + body[x+1:]
+                prev = rows[-1] if rows else None
+                if row or not prev or prev[0] != LG_PLAIN or prev[1] + 1 != x:
+                    fail(lw, "a star goes alone on the row above a platform, one column in")
+                prev[0] = LG_ITEM
+            if body.strip():
+                fail(lw, "one platform or star per row")
+            if row and not MIN_X <= row[1] <= MAX_X:
+                fail(lw, "platform outside columns %d..%d" % (MIN_X, MAX_X))
+            rows.append(row)
+        for i, r in enumerate(rows):
+            if r and r[0] == LG_ITEM and i + 1 == len(rows):
+                fail(where, "star above the top row")
+        out.append((name, tier, rows, where))
+    return out
+
+
+def check(seg, reach, gaps):
+    name, tier, rows, where = seg
+    if not rows[0] or not rows[-1] or rows[-1][0] == LG_ITEM:
+        fail(where, "%s must start and end with a platform" % name)
+    last, gap = None, 0
+    for r in rows:
+        if not r:
+            gap += 1
+            continue
+        if gap > gaps[tier]:
+            fail(where, "%s: gap of %d rows, tier %d allows %d" % (name, gap, tier, gaps[tier]))
+        if last is not None and abs(r[1] - last) > reach[gap + 1]:
+            fail(where, "%s: column %d is out of reach of %d" % (name, r[1], last))
+        last, gap = r[1], 0
+
+
+class Bits:
+    def __init__(self):
+        self.out = bytearray()
+        self.n = 0
+
+    def put(self, v, width):
+        for i in reversed(range(width)):
+            if self.n % 8 == 0:
+                self.out.append(0)
+            if (v >> i) & 1:
+                self.out[-1] |= 0x80 >> (self.n % 8)
+            self.n += 1
+
+
+def pack(rows):
+    b = Bits()
+    b.put(len(rows), 8)
+    i, last = 0, 0
+    while i < len(rows):
+        r = rows[i]
+        if not r:
+            n = 1
+            while n < 4 and i + n < len(rows) and not rows[i + n]:
+                n += 1
+            b.put(0, 1)
+            b.put(n - 1, 2)
+            i += n
+            continue
+        b.put(1, 1)
+        b.put(r[0] - 1, 2)
+        d = r[1] - last
+        if -4 <= d <= 3:
+            b.put(0, 1)
+            b.put(d + 4, 3)
+        else:
+            b.put(1, 1)
+            b.put(r[1], 5)
+        last = r[1]
+        i += 1
+    return bytes(b.out)
+
+
+# the decoder in segments.c, to check the packing
+def unpack(data):
+    pos, mask, byte = 1, 0, 0
+    def bits(n):
+        nonlocal pos, mask, byte
+        v = 0
+        for _ in range(n):
+            if not mask:
+                byte, mask, pos = data[pos], 0x80, pos + 1
+            v = v << 1 | (1 if byte & mask else 0)
+            mask >>= 1
+        return v
+    rows, empty, x = [], 0, 0
+    for _ in range(data[0]):
+        if empty:
+            empty -= 1
+            rows.append(None)
+        elif not bits(1):
+            empty = bits(2)
+            rows.append(None)
+        else:
+            t = bits(2) + 1
+            x = bits(5) if bits(1) else (x + bits(3) - 4) & 0xff
+            rows.append([t, x])
+    return rows
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: segc.py segments.txt segdata.c")
+    root = sys.argv[1][:sys.argv[1].rfind("/") + 1]
+    reach, gaps = read_limits(root)
+    segs = sorted(parse(sys.argv[1]), key=lambda s: s[1])
+    data, starts, plain = bytearray(), [], 0
+    for seg in segs:
+        check(seg, reach, gaps)
+        packed = pack(seg[2])
+        assert unpack(packed) == seg[2], seg[0]
+        starts.append(len(data))
+        data += packed
+        plain += len(seg[2]) + 1
+    counts = [sum(1 for s in segs if s[1] <= t) for t in range(LG_TIERS)]
+
+    o = open(sys.argv[2], "w")
+    o.write("\n// generated from segments.txt by tools/segc.py, do not edit\n")
+    o.write("// %d segments, %d bytes (%d as one byte per row)\n\n" %
+            (len(segs), len(data), plain))
+    o.write('#include "neslib.h"\n#include "levelgen.h"\n#include "segments.h"\n')
+    o.write('#include "mapper.h"\n\n')
+    o.write("// in the level code bank (BANK_LEVEL), see mapper.h\n")
+    o.write('#if NES_MAPPER == 4\n#pragma rodata-name ("RODATA0")\n#endif\n\n')
+    o.write("const byte seg_data[] = {")
+    for seg, start, end in zip(segs, starts, starts[1:] + [len(data)]):
+        o.write("\n  // %s, tier %d\n  " % (seg[0], seg[1]))
+        o.write(" ".join("0x%02x," % v for v in data[start:end]))
+    o.write("\n};\n\n")
+    o.write("const word seg_start[] = {\n  %s\n};\n\n" %
+            ", ".join(str(v) for v in starts))
+    o.write("const byte seg_tier_count[LG_TIERS] = {\n  %s\n};\n" %
+            ", ".join(str(v) for v in counts))
+    o.close()
+    print("%d segments, %d bytes (%d as one byte per row)" %
+          (len(segs), len(data), plain))
+
+
+main()
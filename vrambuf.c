@@ -18,13 +18,16 @@ void vrambuf_clear(void) {
 }
 
 // wait for next frame, then clear buffer
-// this assumes the NMI will call flush_vram_update()
+// this assumes the NMI will call vrambuf_nmi()
 void vrambuf_flush(void) {
   // make sure buffer has EOF marker
   vrambuf_end();
+  // let the NMI interpreter send it
+  vrambuf_ready = 1;
   // wait for next frame to flush update buffer
   // this will also set the scroll registers properly
-  ppu_wait_frame();
+  // (every NMI, since the HUD split must run each frame)
+  ppu_wait_nmi();
   // clear the buffer
   vrambuf_clear();
 }
@@ -47,3 +50,53 @@ void vrambuf_put(word addr, register const char* str, byte len) {
   // place EOF mark
   vrambuf_end();
 }
+
+// add a run of one repeated character
+// costs 4 buffer bytes with VRAMBUF_FILL_OPS, else 3+len
+void vrambuf_fill(word addr, char ch, byte len) {
+  // a zero length would run 256 times
+  if (!len) return;
+#if VRAMBUF_FILL_OPS
+  // if bytes won't fit, wait for vsync and flush buffer
+  if (VBUFSIZE-5 < updptr) {
+    vrambuf_flush();
+  }
+  // add vram address with the fill bit cleared
+  VRAMBUF_ADD(((addr >> 8) ^ NT_UPD_HORZ) & ~NT_UPD_FILL);
+  VRAMBUF_ADD(addr); // only lower 8 bits
+  // add length and the byte to repeat
+  VRAMBUF_ADD(len);
+  VRAMBUF_ADD(ch);
+#else
+  // if bytes won't fit, wait for vsync and flush buffer
+  if (VBUFSIZE-4-len < updptr) {
+    vrambuf_flush();
+  }
+  // add vram address
+  VRAMBUF_ADD((addr >> 8) ^ NT_UPD_HORZ);
+  VRAMBUF_ADD(addr); // only lower 8 bits
+  // add length
+  VRAMBUF_ADD(len);
+  // expand data into buffer
+  memset(updbuf+updptr, ch, len);
+  updptr += len;
+#endif
+  // place EOF mark
+  vrambuf_end();
+}
+
+// send updbuf through vrambuf_nmi() instead of neslib
+void vrambuf_init_nmi(void) {
+  set_vram_update(NULL);
+  vrambuf_clear();
+  vupd_ctrl = get_ppu_ctrl_var();
+  nmi_set_callback(vrambuf_nmi);
+}
+
+// set scroll and keep the vrambuf_nmi() shadow in sync
+void vrambuf_scroll(word x, word y) {
+  scroll(x, y);
+  vupd_ctrl = get_ppu_ctrl_var();
+  vupd_scroll_x = x;
+  vupd_scroll_y = (y < 240) ? y : y - 240;
+}
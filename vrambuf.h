@@ -13,6 +13,9 @@
 // index to end of buffer
 extern byte updptr;
 
+// true if a run of len bytes fits without a flush
+#define VRAMBUF_ROOM(len) (updptr <= VBUFSIZE-4-(len))
+
 // C versions of macros
 #define VRAMBUF_SET(b) updbuf[updptr] = (b);
 #define VRAMBUF_ADD(b) VRAMBUF_SET(b); ++updptr
@@ -26,6 +29,22 @@ extern byte updptr;
 // OR with address to put vertical run
 #define VRAMBUF_VERT	0x8000
 
+// cleared in a run header to mark a fill (one repeated byte)
+// nametable and palette addresses always have this MSB bit set
+#define NT_UPD_FILL	0x20
+
+// 1 if the NMI update interpreter decodes fill runs
+// 0 to expand fills into literal bytes for stock neslib
+#define VRAMBUF_FILL_OPS 1
+
+// set by vrambuf_flush() when the buffer is complete
+extern byte vrambuf_ready;
+
+// PPU_CTRL and scroll shadow restored by vrambuf_nmi()
+extern byte vupd_ctrl;
+extern byte vupd_scroll_x;
+extern byte vupd_scroll_y;
+
 // add EOF marker to buffer (but don't increment pointer)
 void vrambuf_end(void);
 
@@ -33,11 +52,34 @@ void vrambuf_end(void);
 void vrambuf_clear(void);
 
 // wait for next frame, then clear buffer
-// this assumes the NMI will call flush_vram_update()
+// this assumes the NMI will call vrambuf_nmi()
 void vrambuf_flush(void);
 
 // add multiple characters to update buffer
 // using horizontal increment
 void vrambuf_put(word addr, const char* str, byte len);
 
+// add multiple characters to update buffer
+// using vertical increment
+#define vrambuf_put_vert(addr,str,len)\
+  vrambuf_put((addr)|VRAMBUF_VERT, str, len)
+
+// add a run of one repeated character
+// using horizontal increment
+void vrambuf_fill(word addr, char ch, byte len);
+
+// add a run of one repeated character
+// using vertical increment
+#define vrambuf_fill_vert(addr,ch,len)\
+  vrambuf_fill((addr)|VRAMBUF_VERT, ch, len)
+
+// NMI callback that decodes updbuf (vramupd.s)
+void vrambuf_nmi(void);
+
+// send updbuf through vrambuf_nmi() instead of neslib
+void vrambuf_init_nmi(void);
+
+// set scroll and keep the vrambuf_nmi() shadow in sync
+void vrambuf_scroll(word x, word y);
+
 #endif // vrambuf.h
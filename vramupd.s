@@ -0,0 +1,207 @@
+;VRAM update interpreter, called from the NMI through nmi_set_callback()
+;replaces neslib's flush_vram_update() for the buffer at $100 (updbuf)
+
+;buffer format, same as neslib plus fills (see vrambuf.h):
+; MSB, LSB, byte			single write, MSB < $40
+; MSB|$40, LSB, LEN, bytes		horizontal run
+; MSB|$c0, LSB, LEN, bytes		vertical run
+; header with bit 5 clear, LSB, LEN, byte	fill run (byte repeated LEN times)
+; $ff					end of buffer
+
+;runs of up to 32 bytes jump into an unrolled ladder, 4-byte runs have
+;their own path. approximate cycles per run, from instruction timings:
+;
+;				stock neslib	this file
+; 4-tile platform run		136		112
+; 30-tile literal row		552		382
+; 30-tile fill row		552 (literal)	240
+;
+;with ~1600 cycles left in NTSC vblank after OAM DMA that is about
+;87 vs 125 bytes per vblank for literal rows, 47 vs 57 for 4-tile runs,
+;and 200 tiles per vblank for fill rows
+
+	.export _vrambuf_nmi
+	.export _vrambuf_ready
+	.export _vupd_ctrl,_vupd_scroll_x,_vupd_scroll_y
+
+PPU_CTRL	=$2000
+PPU_STATUS	=$2002
+PPU_SCROLL	=$2005
+PPU_ADDR	=$2006
+PPU_DATA	=$2007
+
+UPDBUF		=$0100		;updbuf in vrambuf.h
+LADDER		=32		;longest run handled by the unrolled ladders
+
+.segment "ZEROPAGE"
+
+hdr:		.res 1		;current run header
+len:		.res 1		;current run length
+tmp:		.res 1
+
+.segment "BSS"
+
+;set by vrambuf_flush() when the buffer is complete
+_vrambuf_ready:	.res 1
+
+;PPU_CTRL and scroll shadow, restored after the VRAM writes
+_vupd_ctrl:	.res 1
+_vupd_scroll_x:	.res 1
+_vupd_scroll_y:	.res 1
+
+.segment "CODE"
+
+;void vrambuf_nmi(void);
+
+_vrambuf_nmi:
+	lda _vrambuf_ready	;only run while the main loop waits in vrambuf_flush
+	bne @start
+	rts
+@start:
+	lda #0
+	sta _vrambuf_ready
+	ldx #0
+
+next:
+	lda UPDBUF,x
+	cmp #$40		;single byte write?
+	bcs run
+	sta PPU_ADDR
+	lda UPDBUF+1,x
+	sta PPU_ADDR
+	lda UPDBUF+2,x
+	sta PPU_DATA
+	inx
+	inx
+	inx
+	jmp next
+
+run:
+	cmp #$ff		;end of data?
+	beq done
+	sta hdr
+	lda _vupd_ctrl
+	and #$fb		;+1 increment
+	bit hdr
+	bpl @horz
+	ora #$04		;+32 increment
+@horz:
+	sta PPU_CTRL
+	lda hdr
+	and #$3f
+	ora #$20		;bit 5 marks fills, always set in the MSB
+	sta PPU_ADDR
+	lda UPDBUF+1,x
+	sta PPU_ADDR
+	ldy UPDBUF+2,x
+	sty len
+	lda #$20
+	bit hdr
+	beq fill
+
+	cpy #4			;platform run
+	beq lit4
+	cpy #LADDER+1
+	bcs litloop
+
+	tya			;entry = lit_end-len*6
+	asl a
+	adc len
+	asl a
+	sta tmp
+	lda #<(lit_end-1)
+	sec
+	sbc tmp
+	tay
+	lda #>(lit_end-1)
+	sbc #0
+	pha
+	tya
+	pha
+	txa			;rungs index from the end, so x += len
+	clc
+	adc len
+	tax
+	rts			;jump into the ladder
+
+litloop:
+	lda UPDBUF+3,x
+	sta PPU_DATA
+	inx
+	dey
+	bne litloop
+	jmp lit_end
+
+lit_ladder:
+.repeat LADDER,I
+	lda a:UPDBUF+3-LADDER+I,x
+	sta PPU_DATA
+.endrepeat
+lit_end:
+	inx
+	inx
+	inx
+	jmp next
+
+lit4:
+	lda UPDBUF+3,x
+	sta PPU_DATA
+	lda UPDBUF+4,x
+	sta PPU_DATA
+	lda UPDBUF+5,x
+	sta PPU_DATA
+	lda UPDBUF+6,x
+	sta PPU_DATA
+	txa
+	clc
+	adc #7
+	tax
+	jmp next
+
+fill:
+	cpy #LADDER+1
+	bcs fillloop0
+	tya			;entry = fill_end-len*3
+	asl a
+	adc len
+	sta tmp
+	lda #<(fill_end-1)
+	sec
+	sbc tmp
+	tay
+	lda #>(fill_end-1)
+	sbc #0
+	pha
+	tya
+	pha
+	lda UPDBUF+3,x
+	rts			;jump into the ladder
+
+fillloop0:
+	lda UPDBUF+3,x
+fillloop:
+	sta PPU_DATA
+	dey
+	bne fillloop
+	beq fill_end
+
+fill_ladder:
+.repeat LADDER
+	sta PPU_DATA
+.endrepeat
+fill_end:
+	txa
+	clc
+	adc #4
+	tax
+	jmp next
+
+done:
+	lda PPU_STATUS		;reset the address latch
+	lda _vupd_ctrl		;restore nametable select and scroll
+	sta PPU_CTRL
+	lda _vupd_scroll_x
+	sta PPU_SCROLL
+	lda _vupd_scroll_y
+	sta PPU_SCROLL
+	rts